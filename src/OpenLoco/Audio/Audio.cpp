@@ -17,9 +17,13 @@
 #include "VehicleChannel.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <fstream>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <unordered_map>
 
 #ifdef _WIN32
@@ -86,8 +90,65 @@ namespace OpenLoco::Audio
     static MusicChannel _music_channel;
     static ChannelId _music_current_channel = ChannelId::bgm;
 
+    struct ObjectSample
+    {
+        Sample sample;
+        const void* source{}; // Object data the sample was converted from
+        uint32_t lastUsed{};
+    };
+
+    // Object sample converted by the preload worker, waiting to be added to the cache
+    struct PreloadedSample
+    {
+        uint16_t id;
+        const void* source;
+        Sample sample;
+    };
+
+    struct PreloadRequest
+    {
+        uint16_t id;
+        const void* source;
+        WAVEFORMATEX format;
+        std::vector<std::byte> pcm;
+    };
+
     static std::vector<Sample> _samples;
-    static std::unordered_map<uint16_t, Sample> _object_samples;
+    static std::unordered_map<uint16_t, ObjectSample> _object_samples;
+    static size_t _objectSampleBytes;
+    static uint32_t _objectSampleClock;
+    static SampleCacheStats _sampleCacheStats;
+
+    static std::mutex _preloadMutex;
+    static std::vector<PreloadedSample> _preloadedSamples;
+    static bool _preloadCancelled;
+    static bool _preloadDone;
+
+    // Owns the preload worker. Exit paths that skip disposeDSound (exceptions escaping main,
+    // exit() from the original code or a failed blit) destroy it while the thread may still be
+    // joinable, so the destructor cancels and joins it rather than letting std::terminate run.
+    struct PreloadThread
+    {
+        std::thread thread;
+
+        ~PreloadThread()
+        {
+            cancelAndJoin();
+        }
+
+        void cancelAndJoin()
+        {
+            if (!thread.joinable())
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock(_preloadMutex);
+                _preloadCancelled = true;
+            }
+            thread.join();
+        }
+    };
+    static PreloadThread _preloadThread;
 
     static void playSound(SoundId id, const Map::Pos3& loc, int32_t volume, int32_t pan, int32_t frequency);
     static void mixSound(SoundId id, bool loop, int32_t volume, int32_t pan, int32_t freq);
@@ -145,10 +206,10 @@ namespace OpenLoco::Audio
         return nullptr;
     }
 
-    static Sample loadSoundFromWaveMemory(const WAVEFORMATEX& format, const void* pcm, size_t pcmLen)
+    // Converts the pcm to the output format without creating a mixer chunk, so it is safe to call from any thread.
+    static Sample convertSound(const AudioFormat& dstFormat, const WAVEFORMATEX& format, const void* pcm, size_t pcmLen)
     {
         // Build a CVT to convert the audio
-        const auto& dstFormat = _outputFormat;
         SDL_AudioCVT cvt{};
         auto cr = SDL_BuildAudioCVT(
             &cvt,
@@ -175,7 +236,6 @@ namespace OpenLoco::Audio
             }
             s.len = pcmLen;
             std::memcpy(s.pcm, pcm, s.len);
-            s.chunk = Mix_QuickLoad_RAW((uint8_t*)s.pcm, pcmLen);
             return s;
         }
         else
@@ -191,6 +251,7 @@ namespace OpenLoco::Audio
             if (SDL_ConvertAudio(&cvt) != 0)
             {
                 Console::error("Error during SDL_ConvertAudio: %s", SDL_GetError());
+                std::free(cvt.buf);
                 return {};
             }
 
@@ -204,11 +265,20 @@ namespace OpenLoco::Audio
             Sample s;
             s.pcm = cvt.buf;
             s.len = cvt.len_cvt;
-            s.chunk = Mix_QuickLoad_RAW(cvt.buf, cvt.len_cvt);
             return s;
         }
     }
 
+    static Sample loadSoundFromWaveMemory(const WAVEFORMATEX& format, const void* pcm, size_t pcmLen)
+    {
+        auto s = convertSound(_outputFormat, format, pcm, pcmLen);
+        if (s.pcm != nullptr)
+        {
+            s.chunk = Mix_QuickLoad_RAW((uint8_t*)s.pcm, s.len);
+        }
+        return s;
+    }
+
     static std::vector<Sample> loadSoundsFromCSS(const fs::path& path)
     {
         Console::logVerbose("loadSoundsFromCSS(%s)", path.string().c_str());
@@ -252,6 +322,40 @@ namespace OpenLoco::Audio
         _samples = {};
     }
 
+    static void freeSample(Sample& sample)
+    {
+        if (sample.chunk != nullptr)
+        {
+            Mix_FreeChunk(sample.chunk);
+        }
+        std::free(sample.pcm);
+        sample = {};
+    }
+
+    static void stopPreloadingObjectSamples()
+    {
+        _preloadThread.cancelAndJoin();
+
+        for (auto& preloaded : _preloadedSamples)
+        {
+            freeSample(preloaded.sample);
+        }
+        _preloadedSamples.clear();
+        _preloadCancelled = false;
+        _preloadDone = false;
+    }
+
+    static void disposeObjectSamples()
+    {
+        stopPreloadingObjectSamples();
+        for (auto& [id, objectSample] : _object_samples)
+        {
+            freeSample(objectSample.sample);
+        }
+        _object_samples.clear();
+        _objectSampleBytes = 0;
+    }
+
     static void disposeChannels()
     {
         std::generate(_channels.begin(), _channels.end(), []() { return Channel(); });
@@ -345,6 +449,7 @@ namespace OpenLoco::Audio
     // 0x00404E58
     void disposeDSound()
     {
+        disposeObjectSamples();
         disposeSamples();
         disposeChannels();
         _music_channel = {};
@@ -646,28 +751,208 @@ namespace OpenLoco::Audio
         }
     }
 
+    static bool isChunkPlaying(const Mix_Chunk* chunk)
+    {
+        const auto numChannels = Mix_AllocateChannels(-1);
+        for (auto i = 0; i < numChannels; i++)
+        {
+            if (Mix_Playing(i) && Mix_GetChunk(i) == chunk)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static size_t getSampleCacheBudget()
+    {
+        return static_cast<size_t>(std::max(Config::getNew().audio.sample_cache_size_mb, 1)) * 1024 * 1024;
+    }
+
+    // Evicts the least recently used samples until the cache fits its budget. Samples still
+    // playing are kept, so the cache may briefly exceed the budget.
+    static void trimObjectSamples(uint16_t keepId)
+    {
+        const auto budget = getSampleCacheBudget();
+        while (_objectSampleBytes > budget)
+        {
+            auto lru = _object_samples.end();
+            for (auto it = _object_samples.begin(); it != _object_samples.end(); ++it)
+            {
+                if (it->first == keepId || isChunkPlaying(it->second.sample.chunk))
+                    continue;
+
+                // Compare ages rather than stamps so the clock may wrap
+                if (lru == _object_samples.end() || _objectSampleClock - it->second.lastUsed > _objectSampleClock - lru->second.lastUsed)
+                {
+                    lru = it;
+                }
+            }
+
+            if (lru == _object_samples.end())
+                break;
+
+            _objectSampleBytes -= lru->second.sample.len;
+            freeSample(lru->second.sample);
+            _object_samples.erase(lru);
+            _sampleCacheStats.evictions++;
+        }
+    }
+
+    static ObjectSample* addObjectSample(uint16_t id, const void* source, Sample sample)
+    {
+        sample.chunk = Mix_QuickLoad_RAW((uint8_t*)sample.pcm, sample.len);
+        if (sample.chunk == nullptr)
+        {
+            freeSample(sample);
+            return nullptr;
+        }
+
+        auto& objectSample = _object_samples[id];
+        if (objectSample.sample.pcm != nullptr)
+        {
+            // Sample of an object that has since been replaced, freeing the chunk halts it if still playing
+            _objectSampleBytes -= objectSample.sample.len;
+            freeSample(objectSample.sample);
+        }
+        objectSample.sample = sample;
+        objectSample.source = source;
+        objectSample.lastUsed = _objectSampleClock;
+        _objectSampleBytes += sample.len;
+
+        trimObjectSamples(id);
+        return &objectSample;
+    }
+
+    // Moves samples finished by the preload worker into the cache.
+    static void collectPreloadedSamples()
+    {
+        std::vector<PreloadedSample> preloaded;
+        bool isDone = false;
+        {
+            std::lock_guard<std::mutex> lock(_preloadMutex);
+            preloaded.swap(_preloadedSamples);
+            isDone = _preloadDone;
+        }
+
+        // Everything the worker produced has been taken, so it no longer needs a thread
+        if (isDone && _preloadThread.thread.joinable())
+        {
+            _preloadThread.thread.join();
+        }
+
+        for (auto& entry : preloaded)
+        {
+            // Skip objects that have since been replaced and samples already loaded on demand
+            auto obj = getSoundObject(static_cast<SoundId>(entry.id));
+            auto existing = _object_samples.find(entry.id);
+            if (obj == nullptr || obj->data != entry.source || (existing != _object_samples.end() && existing->second.source == entry.source))
+            {
+                freeSample(entry.sample);
+                continue;
+            }
+            addObjectSample(entry.id, entry.source, entry.sample);
+        }
+    }
+
+    static void preloadWorker(AudioFormat dstFormat, std::vector<PreloadRequest> requests)
+    {
+        for (auto& request : requests)
+        {
+            auto sample = convertSound(dstFormat, request.format, request.pcm.data(), request.pcm.size());
+
+            std::lock_guard<std::mutex> lock(_preloadMutex);
+            if (_preloadCancelled)
+            {
+                freeSample(sample);
+                return;
+            }
+            if (sample.pcm != nullptr)
+            {
+                _preloadedSamples.push_back({ request.id, request.source, sample });
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_preloadMutex);
+        _preloadDone = true;
+    }
+
+    // Converts the samples of all loaded sound objects on a worker thread, so that the first
+    // time a sound plays it does not have to be converted on the main thread.
+    void preloadObjectSamples()
+    {
+        if (!_audio_initialised)
+            return;
+
+        stopPreloadingObjectSamples();
+
+        std::vector<PreloadRequest> requests;
+        size_t numBytes = 0;
+        const auto budget = getSampleCacheBudget();
+        for (size_t i = 0; i < ObjectManager::getMaxObjects(ObjectType::sound); i++)
+        {
+            auto obj = ObjectManager::get<SoundObject>(i);
+            if (obj == nullptr || obj == reinterpret_cast<SoundObject*>(-1))
+                continue;
+
+            auto id = static_cast<uint16_t>(makeObjectSoundId(static_cast<SoundObjectId_t>(i)));
+            auto existing = _object_samples.find(id);
+            if (existing != _object_samples.end() && existing->second.source == obj->data)
+                continue;
+
+            // Source sizes are a rough guide, converted samples are usually larger
+            auto data = (SoundObjectData*)obj->data;
+            assert(data->offset == 8);
+            numBytes += data->length;
+            if (numBytes > budget)
+                break;
+
+            // The pcm is copied as the object may be unloaded while the worker is running
+            PreloadRequest request{ id, obj->data, data->pcm_header, {} };
+            auto pcm = static_cast<const std::byte*>(data->pcm());
+            request.pcm.assign(pcm, pcm + data->length);
+            requests.push_back(std::move(request));
+        }
+
+        if (!requests.empty())
+        {
+            _preloadThread.thread = std::thread(preloadWorker, _outputFormat, std::move(requests));
+        }
+    }
+
     Sample* getSoundSample(SoundId id)
     {
         if (isObjectSoundId(id))
         {
-            // TODO use a LRU queue for object samples
+            collectPreloadedSamples();
+            _objectSampleClock++;
+
+            auto obj = getSoundObject(id);
+            if (obj == nullptr)
+            {
+                return nullptr;
+            }
+
+            // The object of this id may have been replaced since the sample was converted
             auto sr = _object_samples.find((uint16_t)id);
-            if (sr == _object_samples.end())
+            if (sr != _object_samples.end() && sr->second.source == obj->data)
             {
-                auto obj = getSoundObject(id);
-                if (obj != nullptr)
-                {
-                    auto data = (SoundObjectData*)obj->data;
-                    assert(data->offset == 8);
-                    auto sample = loadSoundFromWaveMemory(data->pcm_header, data->pcm(), data->length);
-                    _object_samples[static_cast<size_t>(id)] = sample;
-                    return &_object_samples[static_cast<size_t>(id)];
-                }
+                _sampleCacheStats.hits++;
+                sr->second.lastUsed = _objectSampleClock;
+                return &sr->second.sample;
             }
-            else
+
+            _sampleCacheStats.misses++;
+            auto data = (SoundObjectData*)obj->data;
+            assert(data->offset == 8);
+            auto sample = convertSound(_outputFormat, data->pcm_header, data->pcm(), data->length);
+            if (sample.pcm == nullptr)
             {
-                return &sr->second;
+                return nullptr;
             }
+
+            auto objectSample = addObjectSample(static_cast<uint16_t>(id), obj->data, sample);
+            return objectSample != nullptr ? &objectSample->sample : nullptr;
         }
         else if (static_cast<size_t>(id) < _samples.size())
         {
@@ -676,6 +961,14 @@ namespace OpenLoco::Audio
         return nullptr;
     }
 
+    SampleCacheStats getSampleCacheStats()
+    {
+        auto stats = _sampleCacheStats;
+        stats.numSamples = static_cast<uint32_t>(_object_samples.size());
+        stats.bytesResident = _objectSampleBytes;
+        return stats;
+    }
+
     static void mixSound(SoundId id, bool loop, int32_t volume, int32_t pan, int32_t freq)
     {
         Console::logVerbose("mixSound(%d, %s, %d, %d, %d)", (int32_t)id, loop ? "true" : "false", volume, pan, freq);
@@ -810,113 +1103,233 @@ namespace OpenLoco::Audio
         return false;
     }
 
-    static void sub_48A274(Vehicles::Vehicle2or6* v)
+    // A viewport vehicles may be heard through; the main viewport hears a quarter beyond its edges
+    struct SoundViewport
     {
-        if (v == nullptr)
-            return;
+        Window* window;
+        ViewportRect rect;
+        bool isMain;
 
-        if (v->drivingSoundId == SoundObjectId::null)
-            return;
+        bool contains(const viewport_pos& vpos) const
+        {
+            if (isMain)
+            {
+                return ViewportRect(rect).contains(vpos);
+            }
+            return vpos.y >= rect.top && vpos.y < rect.bottom && vpos.x >= rect.left && vpos.x < rect.right;
+        }
+    };
 
-        // TODO: left or top?
-        if (v->sprite_left == Location::null)
-            return;
+    struct VehicleSoundCandidate
+    {
+        Vehicles::Vehicle2or6* vehicle;
+        Window* window;
+        uint64_t priority; // Lower is more important
 
-        if (_numActiveVehicleSounds >= Config::get().max_vehicle_sounds)
-            return;
+        bool operator<(const VehicleSoundCandidate& rhs) const
+        {
+            return priority < rhs.priority;
+        }
+    };
 
-        auto spritePosition = viewport_pos(v->sprite_left, v->sprite_top);
+    // Vehicles that were allowed to make sound by the last update
+    static std::vector<EntityId_t> _soundVehicles;
+
+    // Maximum height of anything on the map, used to find the tiles a viewport can see
+    constexpr coord_t maxVisibleHeight = 255 * 4;
+    // Sprites extend a little beyond the tile their entity is on
+    constexpr coord_t spriteTileMargin = 2;
+
+    // Viewports in the order the original searched them: the main viewport, then windows from the top down.
+    static std::vector<SoundViewport> getSoundViewports()
+    {
+        std::vector<SoundViewport> viewports;
 
         auto main = WindowManager::getMainWindow();
         if (main != nullptr && main->viewports[0] != nullptr)
         {
             auto viewport = main->viewports[0];
-            ViewportRect extendedViewport = {};
-
             auto quarterWidth = viewport->view_width / 4;
             auto quarterHeight = viewport->view_height / 4;
+
+            ViewportRect extendedViewport = {};
             extendedViewport.left = viewport->view_x - quarterWidth;
             extendedViewport.top = viewport->view_y - quarterHeight;
             extendedViewport.right = viewport->view_x + viewport->view_width + quarterWidth;
             extendedViewport.bottom = viewport->view_y + viewport->view_height + quarterHeight;
-
-            if (extendedViewport.contains(spritePosition))
-            {
-                // jump + return
-                _numActiveVehicleSounds += 1;
-                v->var_4A |= 1;
-                v->sound_window_type = main->type;
-                v->sound_window_number = main->number;
-                return;
-            }
+            viewports.push_back({ main, extendedViewport, true });
         }
 
-        if (WindowManager::count() == 0)
-            return;
-
         for (auto i = (int32_t)WindowManager::count() - 1; i >= 0; i--)
         {
             auto w = WindowManager::get(i);
-
-            if (w->type == WindowType::main)
-                continue;
-
-            if (w->type == WindowType::news)
+            if (w->type == WindowType::main || w->type == WindowType::news)
                 continue;
 
             auto viewport = w->viewports[0];
             if (viewport == nullptr)
                 continue;
 
-            if (viewport->contains(spritePosition))
-            {
-                _numActiveVehicleSounds += 1;
-                v->var_4A |= 1;
-                v->sound_window_type = w->type;
-                v->sound_window_number = w->number;
-                return;
-            }
+            ViewportRect rect = {};
+            rect.left = viewport->view_x;
+            rect.top = viewport->view_y;
+            rect.right = viewport->view_x + viewport->view_width;
+            rect.bottom = viewport->view_y + viewport->view_height;
+            viewports.push_back({ w, rect, false });
         }
+        return viewports;
     }
 
-    static void off_4FEB58(Vehicles::Vehicle2or6* v, int32_t x)
+    // Inclusive range of tiles whose entities can appear within the rect at any height.
+    static std::pair<Map::TilePos2, Map::TilePos2> getVisibleTileRange(const ViewportRect& rect, int32_t rotation)
     {
-        switch (x)
+        Map::TilePos2 min(Map::map_columns, Map::map_rows);
+        Map::TilePos2 max(-1, -1);
+        for (auto x : { rect.left, rect.right })
         {
-            case 0:
-                v->var_4A &= ~1;
-                break;
-            case 1:
-                if (!(v->var_4A & 2))
+            for (auto y : { rect.top, rect.bottom })
+            {
+                for (auto z : { coord_t(0), maxVisibleHeight })
                 {
-                    sub_48A274(v);
+                    auto tile = Map::TilePos2(viewportCoordToMapCoord(x, y, z, rotation));
+                    min.x = std::min(min.x, tile.x);
+                    min.y = std::min(min.y, tile.y);
+                    max.x = std::max(max.x, tile.x);
+                    max.y = std::max(max.y, tile.y);
                 }
-                break;
-            case 2:
-                if (v->var_4A & 2)
+            }
+        }
+
+        const auto margin = Map::TilePos2(spriteTileMargin, spriteTileMargin);
+        min -= margin;
+        max += margin;
+        min.x = std::max<coord_t>(min.x, 0);
+        min.y = std::max<coord_t>(min.y, 0);
+        max.x = std::min<coord_t>(max.x, Map::map_columns - 1);
+        max.y = std::min<coord_t>(max.y, Map::map_rows - 1);
+        return { min, max };
+    }
+
+    // Collects the vehicles that may be heard through any of the viewports. When the viewports
+    // see few tiles the spatial index is used, otherwise every train is checked.
+    static std::vector<Vehicles::Vehicle2or6*> getVehicleSoundSources(const std::vector<SoundViewport>& viewports)
+    {
+        std::vector<Vehicles::Vehicle2or6*> sources;
+
+        const auto rotation = WindowManager::getCurrentRotation();
+        std::vector<std::pair<Map::TilePos2, Map::TilePos2>> ranges;
+        size_t numTiles = 0;
+        for (auto& viewport : viewports)
+        {
+            auto range = getVisibleTileRange(viewport.rect, rotation);
+            if (range.first.x > range.second.x || range.first.y > range.second.y)
+                continue;
+
+            numTiles += (range.second.x - range.first.x + 1) * (range.second.y - range.first.y + 1);
+            ranges.push_back(range);
+        }
+
+        // Each train has two vehicles that can make sound, walking a tile costs about as much as one of them
+        if (numTiles > EntityManager::getListCount(EntityManager::EntityListType::vehicleHead) * 2u)
+        {
+            for (auto v : EntityManager::VehicleList())
+            {
+                Vehicles::Vehicle train(v);
+                sources.push_back(reinterpret_cast<Vehicles::Vehicle2or6*>(train.veh2));
+                sources.push_back(reinterpret_cast<Vehicles::Vehicle2or6*>(train.getTail()));
+            }
+            return sources;
+        }
+
+        for (auto& [min, max] : ranges)
+        {
+            for (coord_t y = min.y; y <= max.y; y++)
+            {
+                for (coord_t x = min.x; x <= max.x; x++)
                 {
-                    sub_48A274(v);
+                    EntityManager::EntityTileList entities(Map::Pos2(Map::TilePos2(x, y)));
+                    for (auto* entity : entities)
+                    {
+                        auto vehicle = entity->asVehicle();
+                        if (vehicle != nullptr && vehicle->isVehicle2Or6())
+                        {
+                            sources.push_back(vehicle->asVehicle2Or6());
+                        }
+                    }
                 }
-                break;
-            case 3:
-                playSound(v);
-                break;
+            }
         }
+
+        // Viewports may overlap
+        std::sort(sources.begin(), sources.end());
+        sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+        return sources;
     }
 
-    static void sub_48A1FA(int32_t x)
+    // 0x0048A274
+    // Vehicles without var_4A & 2 take precedence as the original considered them first, then
+    // those closest to the centre of the viewport they are heard through.
+    static std::optional<VehicleSoundCandidate> getVehicleSoundCandidate(Vehicles::Vehicle2or6* v, const std::vector<SoundViewport>& viewports)
     {
-        if (x == 0)
+        if (v == nullptr)
+            return std::nullopt;
+
+        if (v->drivingSoundId == SoundObjectId::null)
+            return std::nullopt;
+
+        // TODO: left or top?
+        if (v->sprite_left == Location::null)
+            return std::nullopt;
+
+        auto spritePosition = viewport_pos(v->sprite_left, v->sprite_top);
+        for (auto& viewport : viewports)
         {
-            _numActiveVehicleSounds = 0;
+            if (!viewport.contains(spritePosition))
+                continue;
+
+            const int64_t dx = spritePosition.x - (viewport.rect.left + viewport.rect.right) / 2;
+            const int64_t dy = spritePosition.y - (viewport.rect.top + viewport.rect.bottom) / 2;
+            const auto distance = static_cast<uint64_t>(std::min<int64_t>(dx * dx + dy * dy, std::numeric_limits<uint32_t>::max()));
+            const uint64_t group = (v->var_4A & 2) ? 1 : 0;
+            return VehicleSoundCandidate{ v, viewport.window, (group << 32) | distance };
         }
+        return std::nullopt;
+    }
 
-        for (auto v : EntityManager::VehicleList())
+    // 0x0048A1FA
+    static std::vector<VehicleSoundCandidate> selectVehicleSounds()
+    {
+        const auto maxSounds = Config::get().max_vehicle_sounds;
+        if (maxSounds == 0)
+            return {};
+
+        auto viewports = getSoundViewports();
+        if (viewports.empty())
+            return {};
+
+        // Bounded max-heap keeping the most important candidates
+        std::vector<VehicleSoundCandidate> selected;
+        selected.reserve(maxSounds + 1);
+        for (auto* v : getVehicleSoundSources(viewports))
         {
-            Vehicles::Vehicle train(v);
-            off_4FEB58(reinterpret_cast<Vehicles::Vehicle2or6*>(train.veh2), x);
-            off_4FEB58(reinterpret_cast<Vehicles::Vehicle2or6*>(train.tail), x);
+            auto candidate = getVehicleSoundCandidate(v, viewports);
+            if (!candidate)
+                continue;
+
+            if (selected.size() >= maxSounds && !(*candidate < selected.front()))
+                continue;
+
+            selected.push_back(*candidate);
+            std::push_heap(selected.begin(), selected.end());
+            if (selected.size() > maxSounds)
+            {
+                std::pop_heap(selected.begin(), selected.end());
+                selected.pop_back();
+            }
         }
+
+        std::sort_heap(selected.begin(), selected.end());
+        return selected;
     }
 
     // 0x48A73B
@@ -926,18 +1339,55 @@ namespace OpenLoco::Audio
         {
             if (!_audioIsPaused && _audioIsEnabled)
             {
-                sub_48A1FA(0);
-                sub_48A1FA(1);
-                sub_48A1FA(2);
+                for (auto id : _soundVehicles)
+                {
+                    auto vehicle = EntityManager::get<EntityBase>(id)->asVehicle();
+                    if (vehicle != nullptr && vehicle->isVehicle2Or6())
+                    {
+                        vehicle->asVehicle2Or6()->var_4A &= ~1;
+                    }
+                }
+                _soundVehicles.clear();
+
+                auto selected = selectVehicleSounds();
+                for (auto& candidate : selected)
+                {
+                    auto v = candidate.vehicle;
+                    v->var_4A |= 1;
+                    v->sound_window_type = candidate.window->type;
+                    v->sound_window_number = candidate.window->number;
+                    _soundVehicles.push_back(v->id);
+                }
+                _numActiveVehicleSounds = static_cast<uint8_t>(selected.size());
+
                 for (auto& vc : _vehicle_channels)
                 {
                     vc.update();
                 }
-                sub_48A1FA(3);
+
+                // Nearest vehicles get the free channels first
+                for (auto& candidate : selected)
+                {
+                    playSound(candidate.vehicle);
+                }
             }
         }
     }
 
+    // Forgets which vehicles were flagged to make sound. Must be called whenever the entities are
+    // replaced, as the ids of the last update no longer refer to the same vehicles and the new
+    // vehicles may carry flags of their own.
+    void resetVehicleNoise()
+    {
+        _soundVehicles.clear();
+        for (auto v : EntityManager::VehicleList())
+        {
+            Vehicles::Vehicle train(v);
+            train.veh2->var_4A &= ~1;
+            train.getTail()->var_4A &= ~1;
+        }
+    }
+
     // 0x00489C6A
     void stopVehicleNoise()
     {
@@ -24,6 +24,15 @@ namespace OpenLoco::Audio
         Mix_Chunk* chunk{};
     };
 
+    struct SampleCacheStats
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+        uint32_t numSamples;
+        size_t bytesResident;
+    };
+
     // TODO: This should only be a byte needs to be split off from sound object
     enum class SoundId : uint16_t
     {
@@ -93,6 +102,8 @@ namespace OpenLoco::Audio
     void setDevice(size_t index);
 
     Sample* getSoundSample(SoundId id);
+    void preloadObjectSamples();
+    SampleCacheStats getSampleCacheStats();
     bool shouldSoundLoop(SoundId id);
 
     void toggleSound();
@@ -114,6 +125,7 @@ namespace OpenLoco::Audio
 
     void updateVehicleNoise();
     void stopVehicleNoise();
+    void resetVehicleNoise();
 
     void updateAmbientNoise();
     void stopAmbientNoise();
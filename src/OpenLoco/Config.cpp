@@ -72,6 +72,8 @@ namespace OpenLoco::Config
             audioConfig.device = audioNode["device"].as<std::string>("");
             if (audioNode["play_title_music"])
                 audioConfig.play_title_music = audioNode["play_title_music"].as<bool>();
+            if (audioNode["sample_cache_size_mb"])
+                audioConfig.sample_cache_size_mb = audioNode["sample_cache_size_mb"].as<int32_t>();
         }
 
         if (config["loco_install_path"])
@@ -135,6 +137,7 @@ namespace OpenLoco::Config
             audioNode.remove("device");
         }
         audioNode["play_title_music"] = audioConfig.play_title_music;
+        audioNode["sample_cache_size_mb"] = audioConfig.sample_cache_size_mb;
         node["audio"] = audioNode;
 
         node["loco_install_path"] = _new_config.loco_install_path;
@@ -144,6 +144,7 @@ namespace OpenLoco::Config
     {
         std::string device;
         bool play_title_music = true;
+        int32_t sample_cache_size_mb = 32;
     };
 
     struct NewConfig
@@ -1,8 +1,10 @@
 #include "FPSCounter.h"
+#include "../FramePacer.h"
 #include "../Graphics/Colour.h"
 #include "../Graphics/Gfx.h"
 #include "../Localisation/StringManager.h"
 #include "../Ui.h"
+#include "SoftwareDrawingEngine.h"
 
 #include <chrono>
 #include <stdio.h>
@@ -38,14 +40,18 @@ namespace OpenLoco::Drawing
         // Measure FPS
         const float fps = measureFPS();
 
+        // Window drawing of this frame, overdraw is drawn pixels over dirty pixels
+        const auto drawStats = takeDrawStats();
+        const float overdraw = drawStats.dirtyPixels != 0 ? static_cast<float>(drawStats.drawnPixels) / drawStats.dirtyPixels : 0.0f;
+
         // Format string
-        char buffer[64];
+        char buffer[96];
         buffer[0] = ControlCodes::font_bold;
         buffer[1] = ControlCodes::outline;
         buffer[2] = ControlCodes::colour_white;
 
-        const char* formatString = (_currentFPS >= 10.0f ? "%.0f" : "%.1f");
-        snprintf(&buffer[3], std::size(buffer) - 3, formatString, fps);
+        const char* formatString = (_currentFPS >= 10.0f ? "%.0f (jitter %.1f ms, %u draws, overdraw %.2f)" : "%.1f (jitter %.1f ms, %u draws, overdraw %.2f)");
+        snprintf(&buffer[3], std::size(buffer) - 3, formatString, fps, FramePacer::getStats().stdDevMs, drawStats.windowDraws, overdraw);
 
         auto& context = Gfx::screenContext();
 
@@ -56,6 +62,6 @@ namespace OpenLoco::Drawing
         Gfx::drawString(context, x, y, Colour::black, buffer);
 
         // Make area dirty so the text doesn't get drawn over the last
-        Gfx::setDirtyBlocks(x - 16, y - 4, x + 16, 16);
+        Gfx::setDirtyBlocks(x - 16, y - 4, x + stringWidth + 16, 16);
     }
 }
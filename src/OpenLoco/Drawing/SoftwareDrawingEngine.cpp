@@ -13,9 +13,11 @@ namespace OpenLoco::Drawing
     static loco_global<Ui::ScreenInfo, 0x0050B884> screen_info;
     static loco_global<uint8_t[1], 0x00E025C4> _E025C4;
 
+    static DrawStats _drawStats;
+
     static void windowDraw(Context* context, Ui::Window* w, Rect rect);
-    static void windowDraw(Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom);
-    static bool windowDrawSplit(Gfx::Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom);
+    static void windowDraw(Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom, size_t firstOccluder);
+    static bool windowDrawSplit(Gfx::Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom, size_t firstOccluder);
 
     // T[m][n]
     template<typename T>
@@ -169,6 +171,8 @@ namespace OpenLoco::Drawing
         windowContext.pitch = screen_info->context.width + screen_info->context.pitch - rect.width();
         windowContext.zoom_level = 0;
 
+        _drawStats.dirtyPixels += rect.width() * rect.height();
+
         for (size_t i = 0; i < Ui::WindowManager::count(); i++)
         {
             auto w = Ui::WindowManager::get(i);
@@ -188,7 +192,14 @@ namespace OpenLoco::Drawing
 
     static void windowDraw(Context* context, Ui::Window* w, Rect rect)
     {
-        windowDraw(context, w, rect.left(), rect.top(), rect.right(), rect.bottom());
+        windowDraw(context, w, rect.left(), rect.top(), rect.right(), rect.bottom(), Ui::WindowManager::indexOf(w) + 1);
+    }
+
+    static void windowDrawSingle(Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom)
+    {
+        _drawStats.windowDraws++;
+        _drawStats.drawnPixels += (std::min<int16_t>(right, w->x + w->width) - std::max(left, w->x)) * (std::min<int16_t>(bottom, w->y + w->height) - std::max(top, w->y));
+        Ui::WindowManager::drawSingle(context, w, left, top, right, bottom);
     }
 
     /**
@@ -199,14 +210,15 @@ namespace OpenLoco::Drawing
      * @param top @<bx>
      * @param right @<dx>
      * @param bottom @<bp>
+     * @param firstOccluder index of the first window above w that may overlap the region
      */
-    static void windowDraw(Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom)
+    static void windowDraw(Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom, size_t firstOccluder)
     {
         if (!w->isVisible())
             return;
 
         // Split window into only the regions that require drawing
-        if (windowDrawSplit(context, w, left, top, right, bottom))
+        if (windowDrawSplit(context, w, left, top, right, bottom, firstOccluder))
             return;
 
         // Clamp region
@@ -220,7 +232,7 @@ namespace OpenLoco::Drawing
             return;
 
         // Draw the window in this region
-        Ui::WindowManager::drawSingle(context, w, left, top, right, bottom);
+        windowDrawSingle(context, w, left, top, right, bottom);
 
         for (uint32_t index = Ui::WindowManager::indexOf(w) + 1; index < Ui::WindowManager::count(); index++)
         {
@@ -230,7 +242,11 @@ namespace OpenLoco::Drawing
             if ((v->flags & Ui::WindowFlags::transparent) == 0)
                 continue;
 
-            Ui::WindowManager::drawSingle(context, v, left, top, right, bottom);
+            // Nor translucent windows that do not reach this region
+            if (v->x >= right || v->y >= bottom || v->x + v->width <= left || v->y + v->height <= top)
+                continue;
+
+            windowDrawSingle(context, v, left, top, right, bottom);
         }
     }
 
@@ -243,12 +259,14 @@ namespace OpenLoco::Drawing
      * @param top @<bx>
      * @param right @<dx>
      * @param bottom @<bp>
+     * @param firstOccluder index of the first window above w that may overlap the region
      * @return
      */
-    static bool windowDrawSplit(Gfx::Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom)
+    static bool windowDrawSplit(Gfx::Context* context, Ui::Window* w, int16_t left, int16_t top, int16_t right, int16_t bottom, size_t firstOccluder)
     {
-        // Divide the draws up for only the visible regions of the window recursively
-        for (uint32_t index = Ui::WindowManager::indexOf(w) + 1; index < Ui::WindowManager::count(); index++)
+        // Divide the draws up for only the visible regions of the window recursively. Windows
+        // before the one split on did not overlap this region, so neither will its parts.
+        for (size_t index = firstOccluder; index < Ui::WindowManager::count(); index++)
         {
             auto topwindow = Ui::WindowManager::get(index);
 
@@ -264,26 +282,26 @@ namespace OpenLoco::Drawing
             if (topwindow->x > left)
             {
                 // Split draw at topwindow.left
-                windowDraw(context, w, left, top, topwindow->x, bottom);
-                windowDraw(context, w, topwindow->x, top, right, bottom);
+                windowDraw(context, w, left, top, topwindow->x, bottom, index);
+                windowDraw(context, w, topwindow->x, top, right, bottom, index);
             }
             else if (topwindow->x + topwindow->width < right)
             {
                 // Split draw at topwindow.right
-                windowDraw(context, w, left, top, topwindow->x + topwindow->width, bottom);
-                windowDraw(context, w, topwindow->x + topwindow->width, top, right, bottom);
+                windowDraw(context, w, left, top, topwindow->x + topwindow->width, bottom, index);
+                windowDraw(context, w, topwindow->x + topwindow->width, top, right, bottom, index);
             }
             else if (topwindow->y > top)
             {
                 // Split draw at topwindow.top
-                windowDraw(context, w, left, top, right, topwindow->y);
-                windowDraw(context, w, left, topwindow->y, right, bottom);
+                windowDraw(context, w, left, top, right, topwindow->y, index);
+                windowDraw(context, w, left, topwindow->y, right, bottom, index);
             }
             else if (topwindow->y + topwindow->height < bottom)
             {
                 // Split draw at topwindow.bottom
-                windowDraw(context, w, left, top, right, topwindow->y + topwindow->height);
-                windowDraw(context, w, left, topwindow->y + topwindow->height, right, bottom);
+                windowDraw(context, w, left, top, right, topwindow->y + topwindow->height, index);
+                windowDraw(context, w, left, topwindow->y + topwindow->height, right, bottom, index);
             }
 
             // Drawing for this region should be done now, exit
@@ -293,4 +311,11 @@ namespace OpenLoco::Drawing
         // No windows overlap
         return false;
     }
+
+    DrawStats takeDrawStats()
+    {
+        auto stats = _drawStats;
+        _drawStats = {};
+        return stats;
+    }
 }
@@ -4,9 +4,18 @@
 #include "../Ui/Rect.h"
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 namespace OpenLoco::Drawing
 {
+    struct DrawStats
+    {
+        uint32_t dirtyPixels;
+        // Pixels windows were drawn over, more than the dirty pixels where translucent windows overlap
+        uint32_t drawnPixels;
+        uint32_t windowDraws;
+    };
+
     class SoftwareDrawingEngine
     {
     public:
@@ -17,4 +26,7 @@ namespace OpenLoco::Drawing
     private:
         void drawDirtyBlocks(size_t x, size_t y, size_t dx, size_t dy);
     };
+
+    // Statistics of the window drawing since they were last taken.
+    DrawStats takeDrawStats();
 }
@@ -3,6 +3,7 @@
 #include "../Graphics/Gfx.h"
 #include "../Interop/Interop.hpp"
 #include "../ViewportManager.h"
+#include "EntityManager.h"
 #include <algorithm>
 
 using namespace OpenLoco;
@@ -16,12 +17,7 @@ bool EntityBase::isEmpty() const
 // 0x0046FC83
 void EntityBase::moveTo(const Map::Pos3& loc)
 {
-    registers regs;
-    regs.ax = loc.x;
-    regs.cx = loc.y;
-    regs.dx = loc.z;
-    regs.esi = X86Pointer(this);
-    call(0x0046FC83, regs);
+    EntityManager::moveSpatialEntry(*this, loc);
 }
 
 // 0x004CBB01
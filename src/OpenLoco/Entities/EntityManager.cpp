@@ -8,6 +8,8 @@
 #include "../OpenLoco.h"
 #include "../Vehicles/Vehicle.h"
 #include "EntityTweener.h"
+#include <array>
+#include <optional>
 
 using namespace OpenLoco::Interop;
 
@@ -20,6 +22,17 @@ namespace OpenLoco::EntityManager
     loco_global<uint32_t, 0x01025A88> _entitySpatialCount;
     constexpr size_t _entitySpatialIndexNull = 0x40000;
 
+    // Creating an entity when its pool is full fails silently in the original, so the first
+    // failure of each kind since the last reset is logged.
+    enum class EntityLimit
+    {
+        misc,
+        normal,
+        money,
+        count,
+    };
+    static std::array<bool, static_cast<size_t>(EntityLimit::count)> _isLimitReported;
+
     // 0x0046FDFD
     void reset()
     {
@@ -84,6 +97,7 @@ namespace OpenLoco::EntityManager
 
         resetSpatialIndex();
         EntityTweener::get().reset();
+        _isLimitReported.fill(false);
     }
 
     EntityId_t firstId(EntityListType list)
@@ -137,10 +151,133 @@ namespace OpenLoco::EntityManager
         return _entitySpatialIndex[index];
     }
 
+    // The entity before each entity in its quadrant, or EntityId::null for the first. This makes
+    // removal from a quadrant constant time. Entities the original code links into a quadrant
+    // leave it stale, so it is checked before use and the quadrant walked when wrong.
+    static std::array<EntityId_t, maxEntities> _quadrantPreviousIds;
+
+    static void rebuildQuadrantPreviousIds()
+    {
+        _quadrantPreviousIds.fill(EntityId::null);
+        for (auto head : _entitySpatialIndex)
+        {
+            auto previousId = EntityId::null;
+            size_t count = 0;
+            for (auto id = head; id < maxEntities && count < maxEntities; id = _entities[id].nextQuadrantId, count++)
+            {
+                _quadrantPreviousIds[id] = previousId;
+                previousId = id;
+            }
+        }
+    }
+
     // 0x0046FF54
     void resetSpatialIndex()
     {
         call(0x0046FF54);
+        rebuildQuadrantPreviousIds();
+    }
+
+    static void insertToSpatialIndex(EntityBase& entity, size_t index)
+    {
+        const auto nextId = _entitySpatialIndex[index];
+        if (nextId < maxEntities)
+        {
+            _quadrantPreviousIds[nextId] = entity.id;
+        }
+        _quadrantPreviousIds[entity.id] = EntityId::null;
+        entity.nextQuadrantId = nextId;
+        _entitySpatialIndex[index] = entity.id;
+    }
+
+    // Finds the entity before the given one in the quadrant by walking it, EntityId::null if it is the first.
+    static std::optional<EntityId_t> findQuadrantPreviousId(const EntityBase& entity, size_t index)
+    {
+        auto previousId = EntityId::null;
+        auto id = _entitySpatialIndex[index];
+        _entitySpatialCount = 0;
+        while (id < maxEntities)
+        {
+            if (id == entity.id)
+            {
+                return previousId;
+            }
+            _entitySpatialCount++;
+            if (_entitySpatialCount > maxEntities)
+            {
+                break;
+            }
+            previousId = id;
+            id = _entities[id].nextQuadrantId;
+        }
+        return std::nullopt;
+    }
+
+    static bool isQuadrantPreviousId(const EntityBase& entity, size_t index, EntityId_t previousId)
+    {
+        if (previousId == EntityId::null)
+        {
+            return _entitySpatialIndex[index] == entity.id;
+        }
+        if (previousId >= maxEntities)
+        {
+            return false;
+        }
+
+        // Empty entities may keep links from before the original code reset the index
+        const auto& previous = _entities[previousId];
+        return !previous.isEmpty() && previous.nextQuadrantId == entity.id && getSpatialIndexOffset(previous.position) == index;
+    }
+
+    // Returns false if the entity was not found in the quadrant.
+    static bool removeFromSpatialIndex(EntityBase& entity, size_t index)
+    {
+        auto previousId = _quadrantPreviousIds[entity.id];
+        if (!isQuadrantPreviousId(entity, index, previousId))
+        {
+            auto foundId = findQuadrantPreviousId(entity, index);
+            if (!foundId)
+                return false;
+            previousId = *foundId;
+        }
+
+        const auto nextId = entity.nextQuadrantId;
+        if (previousId == EntityId::null)
+        {
+            _entitySpatialIndex[index] = nextId;
+        }
+        else
+        {
+            _entities[previousId].nextQuadrantId = nextId;
+        }
+        if (nextId < maxEntities)
+        {
+            _quadrantPreviousIds[nextId] = previousId;
+        }
+
+        // A stale link would pass the check above once this entity is reused
+        entity.nextQuadrantId = EntityId::null;
+        _quadrantPreviousIds[entity.id] = EntityId::null;
+        return true;
+    }
+
+    // 0x0046FC83
+    void moveSpatialEntry(EntityBase& entity, const Map::Pos3& loc)
+    {
+        const auto newIndex = getSpatialIndexOffset(loc);
+        const auto oldIndex = getSpatialIndexOffset(entity.position);
+        if (newIndex != oldIndex)
+        {
+            if (!removeFromSpatialIndex(entity, oldIndex))
+            {
+                Console::log("Invalid quadrant ids... Reseting spatial index.");
+                resetSpatialIndex();
+                moveSpatialEntry(entity, loc);
+                return;
+            }
+            insertToSpatialIndex(entity, newIndex);
+        }
+        entity.position = loc;
     }
 
     // 0x0046FC57
@@ -166,10 +303,7 @@ namespace OpenLoco::EntityManager
         moveEntityToList(newEntity, list);
 
         newEntity->position = { Location::null, Location::null, 0 };
-        auto index = getSpatialIndexOffset(newEntity->position);
-        auto nextSpatialId = _entitySpatialIndex[index];
-        _entitySpatialIndex[index] = newEntity->id;
-        newEntity->nextQuadrantId = nextSpatialId;
+        insertToSpatialIndex(*newEntity, getSpatialIndexOffset(newEntity->position));
 
         newEntity->name = StringIds::empty_pop;
         newEntity->var_14 = 16;
@@ -181,16 +315,27 @@ namespace OpenLoco::EntityManager
         return newEntity;
     }
 
+    static EntityBase* limitReached(EntityLimit limit, size_t size, const char* description)
+    {
+        auto& isReported = _isLimitReported[static_cast<size_t>(limit)];
+        if (!isReported)
+        {
+            Console::log("Entity limit of %u %s reached", static_cast<uint32_t>(size), description);
+            isReported = true;
+        }
+        return nullptr;
+    }
+
     // 0x004700A5
     EntityBase* createEntityMisc()
     {
         if (getListCount(EntityListType::misc) >= maxMiscEntities)
         {
-            return nullptr;
+            return limitReached(EntityLimit::misc, maxMiscEntities, "effects");
         }
         if (getListCount(EntityListType::null) <= 0)
         {
-            return nullptr;
+            return limitReached(EntityLimit::normal, maxNormalEntities, "vehicles and effects");
         }
 
         auto newId = _heads[static_cast<uint8_t>(EntityListType::null)];
@@ -202,7 +347,7 @@ namespace OpenLoco::EntityManager
     {
         if (getListCount(EntityListType::nullMoney) <= 0)
         {
-            return nullptr;
+            return limitReached(EntityLimit::money, maxMoneyEntities, "money effects");
         }
 
         auto newId = _heads[static_cast<uint8_t>(EntityListType::nullMoney)];
@@ -214,7 +359,7 @@ namespace OpenLoco::EntityManager
     {
         if (getListCount(EntityListType::null) <= 0)
         {
-            return nullptr;
+            return limitReached(EntityLimit::normal, maxNormalEntities, "vehicles and effects");
         }
 
         auto newId = _heads[static_cast<uint8_t>(EntityListType::null)];
@@ -232,25 +377,11 @@ namespace OpenLoco::EntityManager
         entity->base_type = EntityBaseType::null;
 
         // Remove from spatial lists
-        auto* quadId = &_entitySpatialIndex[getSpatialIndexOffset(entity->position)];
-        _entitySpatialCount = 0;
-        while (*quadId < maxEntities)
+        if (!removeFromSpatialIndex(*entity, getSpatialIndexOffset(entity->position)))
         {
-            auto* quadEnt = get<EntityBase>(*quadId);
-            if (quadEnt == entity)
-            {
-                *quadId = entity->nextQuadrantId;
-                return;
-            }
-            _entitySpatialCount++;
-            if (_entitySpatialCount > maxEntities)
-            {
-                break;
-            }
-            quadId = &quadEnt->nextQuadrantId;
+            Console::log("Invalid quadrant ids... Reseting spatial index.");
+            resetSpatialIndex();
         }
-        Console::log("Invalid quadrant ids... Reseting spatial index.");
-        resetSpatialIndex();
     }
 
     // 0x004A8826
@@ -52,6 +52,7 @@ namespace OpenLoco::EntityManager
     EntityId_t firstQuadrantId(const Map::Pos2& loc);
     void resetSpatialIndex();
     void updateSpatialIndex();
+    void moveSpatialEntry(EntityBase& entity, const Map::Pos3& loc);
 
     EntityBase* createEntityMisc();
     EntityBase* createEntityMoney();
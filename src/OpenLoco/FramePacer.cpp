@@ -0,0 +1,94 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace OpenLoco::FramePacer
+{
+    // Sleeping is only accurate to around a millisecond, so the remainder of a wait is spent yielding.
+    constexpr auto spinThreshold = std::chrono::microseconds(1500);
+
+    // Frame time statistics are gathered over this period and then published.
+    constexpr auto statsPeriod = std::chrono::seconds(1);
+
+    static Clock::time_point _lastFrame;
+    static Clock::time_point _periodStart;
+    static uint32_t _numFrames;
+    static double _sumMs;
+    static double _sumSquaredMs;
+    static double _minMs = std::numeric_limits<double>::max();
+    static double _maxMs;
+    static FrameStats _stats;
+
+    void waitUntil(Clock::time_point deadline)
+    {
+        auto remaining = deadline - Clock::now();
+        if (remaining > spinThreshold)
+        {
+            std::this_thread::sleep_for(remaining - spinThreshold);
+        }
+
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void waitFor(Clock::duration duration)
+    {
+        waitUntil(Clock::now() + duration);
+    }
+
+    // Records the time since the previous frame for the frame time statistics.
+    void frameRendered()
+    {
+        const auto now = Clock::now();
+        if (_lastFrame == Clock::time_point{})
+        {
+            _lastFrame = now;
+            _periodStart = now;
+            return;
+        }
+
+        const auto frameMs = std::chrono::duration<double, std::milli>(now - _lastFrame).count();
+        _lastFrame = now;
+
+        _numFrames++;
+        _sumMs += frameMs;
+        _sumSquaredMs += frameMs * frameMs;
+        _minMs = std::min(_minMs, frameMs);
+        _maxMs = std::max(_maxMs, frameMs);
+
+        if (now - _periodStart >= statsPeriod)
+        {
+            const auto mean = _sumMs / _numFrames;
+            const auto variance = std::max(0.0, _sumSquaredMs / _numFrames - mean * mean);
+            _stats.meanMs = static_cast<float>(mean);
+            _stats.stdDevMs = static_cast<float>(std::sqrt(variance));
+            _stats.minMs = static_cast<float>(_minMs);
+            _stats.maxMs = static_cast<float>(_maxMs);
+
+            _periodStart = now;
+            _numFrames = 0;
+            _sumMs = 0;
+            _sumSquaredMs = 0;
+            _minMs = std::numeric_limits<double>::max();
+            _maxMs = 0;
+        }
+    }
+
+    FrameStats getStats()
+    {
+        return _stats;
+    }
+
+    // Frame interval for a display refresh rate in Hz, or zero if the rate is unknown.
+    Clock::duration getRefreshInterval(int32_t refreshRate)
+    {
+        if (refreshRate <= 0)
+            return Clock::duration::zero();
+
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / refreshRate));
+    }
+}
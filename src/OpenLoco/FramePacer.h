@@ -0,0 +1,23 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace OpenLoco::FramePacer
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct FrameStats
+    {
+        float meanMs;
+        float stdDevMs;
+        float minMs;
+        float maxMs;
+    };
+
+    void waitUntil(Clock::time_point deadline);
+    void waitFor(Clock::duration duration);
+    void frameRendered();
+    FrameStats getStats();
+    Clock::duration getRefreshInterval(int32_t refreshRate);
+}
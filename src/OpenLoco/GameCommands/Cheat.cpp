@@ -57,7 +57,7 @@ namespace OpenLoco::GameCommands
                 train.head->owner = ourCompanyId;
                 train.veh1->owner = ourCompanyId;
                 train.veh2->owner = ourCompanyId;
-                train.tail->owner = ourCompanyId;
+                train.getTail()->owner = ourCompanyId;
 
                 for (auto& car : train.cars)
                 {
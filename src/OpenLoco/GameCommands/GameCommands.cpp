@@ -1,4 +1,5 @@
 #include "GameCommands.h"
+#include "Journal.h"
 #include "../Audio/Audio.h"
 #include "../Company.h"
 #include "../CompanyManager.h"
@@ -11,7 +12,9 @@
 #include "../StationManager.h"
 #include "../Ui/WindowManager.h"
 #include "../Vehicles/Vehicle.h"
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 using namespace OpenLoco::Ui;
 using namespace OpenLoco::Map;
@@ -160,21 +163,9 @@ namespace OpenLoco::GameCommands
         return true;
     }
 
-    // 0x00431315
-    uint32_t doCommand(GameCommand command, const registers& regs)
+    // Unpauses the game for top-level applied commands; returns false if the game remains paused.
+    static bool prepareTopLevelCommand(GameCommand command, uint16_t flags)
     {
-        uint16_t flags = regs.bx;
-        uint32_t esi = static_cast<uint32_t>(command);
-
-        _gameCommandFlags = regs.bx;
-        if (game_command_nest_level != 0)
-            return loc_4313C6(esi, regs);
-
-        if ((flags & Flags::apply) == 0)
-        {
-            return loc_4313C6(esi, regs);
-        }
-
         if (commandRequiresUnpausingGame(command, flags) && _updating_company_id == _player_company[0])
         {
             if (getPauseFlags() & 1)
@@ -194,9 +185,31 @@ namespace OpenLoco::GameCommands
             if (isPaused())
             {
                 _gGameCommandErrorText = StringIds::empty;
-                return 0x80000000;
+                return false;
             }
         }
+        return true;
+    }
+
+    // 0x00431315
+    uint32_t doCommand(GameCommand command, const registers& regs)
+    {
+        uint16_t flags = regs.bx;
+        uint32_t esi = static_cast<uint32_t>(command);
+
+        _gameCommandFlags = regs.bx;
+        if (game_command_nest_level != 0)
+            return loc_4313C6(esi, regs);
+
+        if ((flags & Flags::apply) == 0)
+        {
+            return loc_4313C6(esi, regs);
+        }
+
+        if (!prepareTopLevelCommand(command, flags))
+        {
+            return 0x80000000;
+        }
 
         if (_updating_company_id == _player_company[0] && isNetworked())
         {
@@ -205,6 +218,7 @@ namespace OpenLoco::GameCommands
             call(0x0046E34A, fnRegs); // some network stuff. Untested
         }
 
+        Journal::recordCommand(command, regs);
         return loc_4313C6(esi, regs);
     }
 
@@ -313,6 +327,140 @@ namespace OpenLoco::GameCommands
         return ebx;
     }
 
+    // Batched variant of loc_4313C6: every entry is queried in one pass and the successful
+    // ones are applied in a second pass. Cost is charged and displayed only once. If the
+    // company can't afford the whole batch, each entry is checked against what is left after
+    // the entries before it, as if they had been issued separately.
+    BatchResult doCommandBatch(GameCommand command, stdx::span<const registers> batch, uint8_t flags)
+    {
+        BatchResult result{};
+        const uint32_t esi = static_cast<uint32_t>(command);
+
+        _gameCommandFlags = flags;
+        if (game_command_nest_level == 0 && (flags & Flags::apply) != 0)
+        {
+            if (!prepareTopLevelCommand(command, flags))
+            {
+                result.numFailed = batch.size();
+                return result;
+            }
+            Journal::recordBatch(command, batch, flags);
+        }
+
+        game_command_nest_level++;
+
+        // Query pass
+        std::vector<std::pair<size_t, int32_t>> validEntries;
+        validEntries.reserve(batch.size());
+        int32_t totalCost = 0;
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            _gGameCommandErrorText = StringIds::null;
+            registers fnRegs = batch[i];
+            fnRegs.bl = flags & ~Flags::apply;
+            callGameCommandFunction(esi, fnRegs);
+            _gameCommandFlags = flags;
+
+            const int32_t cost = fnRegs.ebx;
+            if (cost == static_cast<int32_t>(0x80000000))
+            {
+                result.numFailed++;
+                continue;
+            }
+            validEntries.emplace_back(i, isEditorMode() ? 0 : cost);
+            totalCost += validEntries.back().second;
+        }
+
+        if (game_command_nest_level == 1
+            && !validEntries.empty()
+            && (flags & Flags::flag_2) == 0
+            && (flags & Flags::flag_6) == 0
+            && totalCost != 0)
+        {
+            registers regs2;
+            regs2.ebp = totalCost;
+            call(0x0046DD06, regs2);
+            if (regs2.ebp == static_cast<int32_t>(0x80000000))
+            {
+                // Can't afford the whole batch; keep the entries that would still have been
+                // affordable had they been issued one at a time, in order.
+                std::vector<std::pair<size_t, int32_t>> affordableEntries;
+                int32_t affordableCost = 0;
+                for (auto& entry : validEntries)
+                {
+                    registers regs3;
+                    regs3.ebp = affordableCost + entry.second;
+                    call(0x0046DD06, regs3);
+                    if (regs3.ebp == static_cast<int32_t>(0x80000000))
+                    {
+                        result.numFailed++;
+                        continue;
+                    }
+                    affordableEntries.push_back(entry);
+                    affordableCost += entry.second;
+                }
+                validEntries = std::move(affordableEntries);
+                totalCost = affordableCost;
+                if (validEntries.empty())
+                {
+                    game_command_nest_level--;
+                    return result;
+                }
+            }
+        }
+
+        if ((flags & Flags::apply) == 0)
+        {
+            result.numSucceeded = validEntries.size();
+            result.cost = totalCost;
+            game_command_nest_level--;
+            return result;
+        }
+
+        // Apply pass; an entry can still fail here if an earlier entry of the batch now blocks it.
+        Map::Pos3 lastPosition = getPosition();
+        totalCost = 0;
+        for (auto& [index, queryCost] : validEntries)
+        {
+            _gGameCommandErrorText = StringIds::null;
+            registers fnRegs = batch[index];
+            fnRegs.bl = flags;
+            callGameCommandFunction(esi, fnRegs);
+            _gameCommandFlags = flags;
+
+            int32_t cost = fnRegs.ebx;
+            if (cost == static_cast<int32_t>(0x80000000))
+            {
+                result.numFailed++;
+                continue;
+            }
+            if (isEditorMode())
+            {
+                cost = 0;
+            }
+            totalCost += std::min(cost, queryCost);
+            lastPosition = getPosition();
+            result.numSucceeded++;
+        }
+        result.cost = totalCost;
+
+        game_command_nest_level--;
+        if (game_command_nest_level != 0 || result.numSucceeded == 0)
+            return result;
+
+        if ((flags & Flags::flag_5) != 0)
+            return result;
+
+        CompanyManager::applyPaymentToCompany(CompanyManager::updatingCompanyId(), totalCost, getExpenditureType());
+
+        if (totalCost != 0 && _updating_company_id == _player_company[0])
+        {
+            CompanyManager::spendMoneyEffect(lastPosition + Map::Pos3{ 0, 0, 24 }, _updating_company_id, totalCost);
+        }
+
+        return result;
+    }
+
     static uint32_t loc_4314EA()
     {
         game_command_nest_level--;
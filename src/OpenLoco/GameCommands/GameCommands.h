@@ -1,10 +1,12 @@
 #pragma once
 
+#include "../Core/Span.hpp"
 #include "../Economy/Currency.h"
 #include "../Entities/Entity.h"
 #include "../Interop/Interop.hpp"
 #include "../Map/Tile.h"
 #include "../Objects/ObjectManager.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -138,6 +140,27 @@ namespace OpenLoco::GameCommands
         return doCommand(T::command, regs);
     }
 
+    struct BatchResult
+    {
+        currency32_t cost;
+        uint32_t numSucceeded;
+        uint32_t numFailed;
+    };
+
+    BatchResult doCommandBatch(GameCommand command, stdx::span<const registers> batch, uint8_t flags);
+
+    template<typename T>
+    BatchResult doCommandBatch(const std::vector<T>& args, uint8_t flags)
+    {
+        std::vector<registers> batch;
+        batch.reserve(args.size());
+        for (const auto& entry : args)
+        {
+            batch.push_back(registers(entry));
+        }
+        return doCommandBatch(T::command, batch, flags);
+    }
+
     inline void do_0(EntityId_t source, EntityId_t dest)
     {
         registers regs;
@@ -0,0 +1,421 @@
+#include "Journal.h"
+#include "../CompanyManager.h"
+#include "../Console.h"
+#include "../Date.h"
+#include "../Entities/EntityManager.h"
+#include "../Map/TileManager.h"
+#include "../OpenLoco.h"
+#include "../S5/S5.h"
+#include "../Utility/Stream.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+namespace OpenLoco::GameCommands::Journal
+{
+    enum class Mode : uint8_t
+    {
+        none,
+        recording,
+        replaying,
+    };
+
+    enum class RecordType : uint8_t
+    {
+        command,
+        batch,
+        checksum,
+    };
+
+    constexpr uint32_t journalMagic = 0x314A4C4F; // OLJ1
+
+    struct Entry
+    {
+        RecordType type;
+        uint32_t tick;
+        CompanyId_t company;
+        GameCommand command;
+        uint8_t flags;
+        uint32_t checksum;
+        std::vector<registers> regs;
+    };
+
+    static Mode _mode = Mode::none;
+    static bool _isTicking = false;
+    static fs::path _pendingRecordPath;
+    static fs::path _pendingReplayPath;
+
+    // Recording
+    static std::ofstream _outStream;
+
+    // Replaying
+    static std::vector<Entry> _entries;
+    static size_t _cursor = 0;
+    static uint32_t _numTicksReplayed = 0;
+    static std::chrono::high_resolution_clock::time_point _replayStart;
+
+    static fs::path getSavePath(const fs::path& path)
+    {
+        auto savePath = path;
+        savePath.replace_extension(S5::extensionSV5);
+        return savePath;
+    }
+
+    template<typename T>
+    static void writeValue(std::ostream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static void writeRegisters(std::ostream& stream, const registers& regs)
+    {
+        writeValue(stream, regs.eax);
+        writeValue(stream, regs.ebx);
+        writeValue(stream, regs.ecx);
+        writeValue(stream, regs.edx);
+        writeValue(stream, regs.esi);
+        writeValue(stream, regs.edi);
+        writeValue(stream, regs.ebp);
+    }
+
+    static registers readRegisters(std::istream& stream)
+    {
+        registers regs;
+        regs.eax = Utility::readValue<int32_t>(stream);
+        regs.ebx = Utility::readValue<int32_t>(stream);
+        regs.ecx = Utility::readValue<int32_t>(stream);
+        regs.edx = Utility::readValue<int32_t>(stream);
+        regs.esi = Utility::readValue<int32_t>(stream);
+        regs.edi = Utility::readValue<int32_t>(stream);
+        regs.ebp = Utility::readValue<int32_t>(stream);
+        return regs;
+    }
+
+    // Commands that do not affect the simulation or that would interrupt a replay.
+    static bool isJournaled(GameCommand command)
+    {
+        switch (command)
+        {
+            case GameCommand::pauseGame:
+            case GameCommand::loadSaveQuitGame:
+            case GameCommand::loadMultiplayerMap:
+            case GameCommand::sendChatMessage:
+            case GameCommand::multiplayerSave:
+                return false;
+            default:
+                return true;
+        }
+    }
+
+    // Journaling is opted into through the environment, e.g. OPENLOCO_JOURNAL_RECORD=session.olj
+    void initialise()
+    {
+        auto recordPath = std::getenv("OPENLOCO_JOURNAL_RECORD");
+        if (recordPath != nullptr && recordPath[0] != '\0')
+        {
+            _pendingRecordPath = fs::u8path(recordPath);
+        }
+
+        auto replayPath = std::getenv("OPENLOCO_JOURNAL_REPLAY");
+        if (replayPath != nullptr && replayPath[0] != '\0')
+        {
+            _pendingReplayPath = fs::u8path(replayPath);
+        }
+    }
+
+    // Starts any pending recording or replay. Must be called outside of the tick logic,
+    // as starting either loads a save and therefore ends the current tick.
+    void update()
+    {
+        if (!_pendingReplayPath.empty())
+        {
+            auto path = _pendingReplayPath;
+            _pendingReplayPath.clear();
+            startReplay(path);
+        }
+        else if (!_pendingRecordPath.empty() && !isTitleMode() && !isEditorMode())
+        {
+            auto path = _pendingRecordPath;
+            _pendingRecordPath.clear();
+            startRecording(path);
+        }
+    }
+
+    void startRecording(const fs::path& path)
+    {
+        stopRecording();
+        stopReplay();
+
+        auto savePath = getSavePath(path);
+        if (!S5::save(savePath, S5::SaveFlags::noWindowClose))
+        {
+            Console::error("Unable to save journal start state to %s", savePath.u8string().c_str());
+            return;
+        }
+
+        std::error_code ec;
+        _outStream.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!_outStream.is_open())
+        {
+            Console::error("Unable to open journal %s", path.u8string().c_str());
+            fs::remove(savePath, ec);
+            return;
+        }
+        writeValue(_outStream, journalMagic);
+        _mode = Mode::recording;
+        _isTicking = false;
+        Console::log("Recording game commands to %s", path.u8string().c_str());
+
+        // Reload the save so the recording starts from exactly the state a replay will see.
+        // On success this ends the current tick.
+        S5::load(savePath, 0);
+
+        // The journal holds nothing but its header, so don't leave it behind
+        Console::error("Unable to load journal start state");
+        stopRecording();
+        fs::remove(path, ec);
+        fs::remove(savePath, ec);
+    }
+
+    void stopRecording()
+    {
+        if (_mode != Mode::recording)
+            return;
+
+        _outStream.close();
+        _mode = Mode::none;
+    }
+
+    bool isRecording()
+    {
+        return _mode == Mode::recording;
+    }
+
+    static bool readJournal(const fs::path& path)
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        if (!stream.is_open() || Utility::readValue<uint32_t>(stream) != journalMagic)
+        {
+            return false;
+        }
+
+        _entries.clear();
+        while (true)
+        {
+            Entry entry{};
+            if (!Utility::readData(stream, entry.type))
+                break;
+
+            entry.tick = Utility::readValue<uint32_t>(stream);
+            switch (entry.type)
+            {
+                case RecordType::command:
+                    entry.company = Utility::readValue<CompanyId_t>(stream);
+                    entry.command = Utility::readValue<GameCommand>(stream);
+                    entry.regs.push_back(readRegisters(stream));
+                    break;
+                case RecordType::batch:
+                {
+                    entry.company = Utility::readValue<CompanyId_t>(stream);
+                    entry.command = Utility::readValue<GameCommand>(stream);
+                    entry.flags = Utility::readValue<uint8_t>(stream);
+                    auto count = Utility::readValue<uint32_t>(stream);
+                    for (uint32_t i = 0; i < count && stream; ++i)
+                    {
+                        entry.regs.push_back(readRegisters(stream));
+                    }
+                    break;
+                }
+                case RecordType::checksum:
+                    entry.checksum = Utility::readValue<uint32_t>(stream);
+                    break;
+                default:
+                    return false;
+            }
+
+            if (!stream)
+                return false;
+
+            _entries.push_back(std::move(entry));
+        }
+        return true;
+    }
+
+    void startReplay(const fs::path& path)
+    {
+        stopRecording();
+        stopReplay();
+
+        if (!readJournal(path))
+        {
+            Console::error("Unable to read journal %s", path.u8string().c_str());
+            return;
+        }
+
+        _cursor = 0;
+        _numTicksReplayed = 0;
+        _isTicking = false;
+        _mode = Mode::replaying;
+        _replayStart = std::chrono::high_resolution_clock::now();
+        Console::log("Replaying %u journal entries from %s", static_cast<uint32_t>(_entries.size()), path.u8string().c_str());
+
+        // On success this ends the current tick.
+        S5::load(getSavePath(path), 0);
+
+        Console::error("Unable to load journal start state");
+        stopReplay();
+    }
+
+    void stopReplay()
+    {
+        if (_mode != Mode::replaying)
+            return;
+
+        _entries.clear();
+        _cursor = 0;
+        _mode = Mode::none;
+    }
+
+    bool isReplaying()
+    {
+        return _mode == Mode::replaying;
+    }
+
+    void recordCommand(GameCommand command, const registers& regs)
+    {
+        if (_mode != Mode::recording || _isTicking || !isJournaled(command))
+            return;
+
+        writeValue(_outStream, RecordType::command);
+        writeValue(_outStream, scenarioTicks());
+        writeValue(_outStream, CompanyManager::updatingCompanyId());
+        writeValue(_outStream, command);
+        writeRegisters(_outStream, regs);
+    }
+
+    void recordBatch(GameCommand command, stdx::span<const registers> batch, uint8_t flags)
+    {
+        if (_mode != Mode::recording || _isTicking || !isJournaled(command))
+            return;
+
+        writeValue(_outStream, RecordType::batch);
+        writeValue(_outStream, scenarioTicks());
+        writeValue(_outStream, CompanyManager::updatingCompanyId());
+        writeValue(_outStream, command);
+        writeValue(_outStream, flags);
+        writeValue(_outStream, static_cast<uint32_t>(batch.size()));
+        for (auto& regs : batch)
+        {
+            writeRegisters(_outStream, regs);
+        }
+    }
+
+    static void replayEntry(const Entry& entry)
+    {
+        auto previousId = CompanyManager::updatingCompanyId();
+        CompanyManager::updatingCompanyId(entry.company);
+
+        if (entry.type == RecordType::batch)
+        {
+            doCommandBatch(entry.command, entry.regs, entry.flags);
+        }
+        else
+        {
+            doCommand(entry.command, entry.regs.front());
+        }
+
+        CompanyManager::updatingCompanyId(previousId);
+    }
+
+    // Called at the start of the tick logic, before the scenario tick counter is advanced.
+    void preTick()
+    {
+        if (_mode == Mode::replaying)
+        {
+            while (_cursor < _entries.size()
+                   && _entries[_cursor].type != RecordType::checksum
+                   && _entries[_cursor].tick <= scenarioTicks())
+            {
+                replayEntry(_entries[_cursor]);
+                _cursor++;
+            }
+        }
+        _isTicking = true;
+    }
+
+    static void finishReplay(const char* reason)
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - _replayStart).count();
+        Console::log("Replay %s after %u ticks in %d ms", reason, _numTicksReplayed, static_cast<int32_t>(elapsed));
+        stopReplay();
+    }
+
+    // Called at the end of the tick logic.
+    void postTick()
+    {
+        _isTicking = false;
+
+        if (_mode == Mode::recording)
+        {
+            writeValue(_outStream, RecordType::checksum);
+            writeValue(_outStream, scenarioTicks());
+            writeValue(_outStream, computeStateChecksum());
+        }
+        else if (_mode == Mode::replaying)
+        {
+            _numTicksReplayed++;
+            if (_cursor >= _entries.size())
+            {
+                finishReplay("finished");
+                return;
+            }
+
+            const auto& entry = _entries[_cursor];
+            const auto checksum = computeStateChecksum();
+            if (entry.type != RecordType::checksum || entry.tick != scenarioTicks() || entry.checksum != checksum)
+            {
+                Console::error("Replay diverged at tick %u: expected checksum %08X for tick %u, got %08X", scenarioTicks(), entry.checksum, entry.tick, checksum);
+                finishReplay("stopped");
+                return;
+            }
+
+            _cursor++;
+            if (_cursor >= _entries.size())
+            {
+                finishReplay("finished");
+            }
+        }
+    }
+
+    // Only simulation state is hashed; viewport dependent data such as sprite bounds is skipped.
+    uint32_t computeStateChecksum()
+    {
+        uint32_t hash = 2166136261u;
+        auto mix = [&hash](uint32_t value) {
+            hash = (hash ^ value) * 16777619u;
+        };
+
+        auto& prng = gPrng();
+        mix(prng.srand_0());
+        mix(prng.srand_1());
+        mix(scenarioTicks());
+        mix(getCurrentDay());
+        mix(static_cast<uint32_t>(Map::TileManager::getElementsEnd() - Map::TileManager::getElements().data()));
+
+        for (auto& company : CompanyManager::companies())
+        {
+            mix(company.cash.var_00);
+            mix(static_cast<uint16_t>(company.cash.var_04));
+        }
+
+        for (EntityId_t id = 0; id < EntityManager::maxEntities; ++id)
+        {
+            auto* entity = EntityManager::get<EntityBase>(id);
+            mix(static_cast<uint32_t>(entity->base_type) | (static_cast<uint32_t>(entity->owner) << 8));
+            mix(static_cast<uint16_t>(entity->position.x) | (static_cast<uint32_t>(static_cast<uint16_t>(entity->position.y)) << 16));
+            mix(static_cast<uint16_t>(entity->position.z));
+        }
+        return hash;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Core/FileSystem.hpp"
+#include "../Core/Span.hpp"
+#include "GameCommands.h"
+#include <cstdint>
+
+// Records every game command issued by the player, together with the tick it was issued on,
+// next to a save of the starting state. Replaying the journal re-applies the commands from
+// that save without rendering and verifies a checksum of the simulation state after every tick.
+namespace OpenLoco::GameCommands::Journal
+{
+    constexpr const char* extension = ".OLJ";
+
+    void initialise();
+    void update();
+
+    // Both load the journal's start save, so on success they end the current tick by throwing
+    // out of it and do not return. On failure an error is logged and they return normally.
+    void startRecording(const fs::path& path);
+    void stopRecording();
+    bool isRecording();
+
+    void startReplay(const fs::path& path);
+    void stopReplay();
+    bool isReplaying();
+
+    void recordCommand(GameCommand command, const registers& regs);
+    void recordBatch(GameCommand command, stdx::span<const registers> batch, uint8_t flags);
+
+    void preTick();
+    void postTick();
+
+    uint32_t computeStateChecksum();
+}
@@ -48,7 +48,7 @@ namespace OpenLoco::GameCommands
         train.head->var_38 &= ~(Vehicles::Flags38::isGhost);
         train.veh1->var_38 &= ~(Vehicles::Flags38::isGhost);
         train.veh2->var_38 &= ~(Vehicles::Flags38::isGhost);
-        train.tail->var_38 &= ~(Vehicles::Flags38::isGhost);
+        train.getTail()->var_38 &= ~(Vehicles::Flags38::isGhost);
 
         for (auto& car : train.cars)
         {
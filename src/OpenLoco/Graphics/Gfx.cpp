@@ -13,6 +13,7 @@
 #include "ImageIds.h"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -269,127 +270,47 @@ namespace OpenLoco::Gfx
         clear(context, fill);
     }
 
-    // 0x004957C4
-    int16_t clipString(int16_t width, char* string)
+    // Running width of a string measured one character at a time. The advance row of the current
+    // font is looked up on font changes rather than for every character.
+    struct TextMeasurement
     {
-        if (width < 6)
+        const uint8_t* advances;
+        uint16_t width = 0;
+        uint16_t maxWidth = 0;
+
+        TextMeasurement(int16_t fontSpriteBase)
         {
-            *string = '\0';
-            return 0;
+            setFont(fontSpriteBase);
         }
 
-        // If width of the full string is less than allowed width then we don't need to clip
-        auto clippedWidth = getStringWidth(string);
-        if (clippedWidth <= width)
+        void setFont(int16_t fontSpriteBase)
         {
-            return clippedWidth;
+            advances = &_characterWidths[fontSpriteBase];
         }
 
-        // Append each character 1 by 1 with an ellipsis on the end until width is exceeded
-        std::string bestString;
-        std::string curString;
-
-        for (const auto* chr = string; *chr != '\0'; ++chr)
+        uint16_t getEllipsisWidth() const
         {
-            curString.push_back(*chr);
-            switch (*chr)
-            {
-                case ControlCodes::move_x:
-                    curString.push_back(*++chr);
-                    break;
-
-                case ControlCodes::adjust_palette:
-                case 3:
-                case 4:
-                    curString.push_back(*++chr);
-                    break;
-
-                case ControlCodes::newline:
-                case ControlCodes::newline_smaller:
-                case ControlCodes::font_small:
-                case ControlCodes::font_large:
-                case ControlCodes::font_bold:
-                case ControlCodes::font_regular:
-                case ControlCodes::outline:
-                case ControlCodes::outline_off:
-                case ControlCodes::window_colour_1:
-                case ControlCodes::window_colour_2:
-                case ControlCodes::window_colour_3:
-                case ControlCodes::window_colour_4:
-                    break;
-
-                case ControlCodes::inline_sprite_str:
-                    curString.push_back(*++chr);
-                    curString.push_back(*++chr);
-                    curString.push_back(*++chr);
-                    curString.push_back(*++chr);
-                    break;
-
-                case ControlCodes::newline_x_y:
-                    curString.push_back(*++chr);
-                    curString.push_back(*++chr);
-                    break;
-
-                default:
-                    if (*chr <= 0x16)
-                    {
-                        curString.push_back(*++chr);
-                        curString.push_back(*++chr);
-                    }
-                    else if (*chr < 32)
-                    {
-                        curString.push_back(*++chr);
-                        curString.push_back(*++chr);
-                        curString.push_back(*++chr);
-                        curString.push_back(*++chr);
-                    }
-                    break;
-            }
-
-            auto ellipseString = curString;
-            ellipseString.append("...");
-
-            auto ellipsedWidth = getStringWidth(ellipseString.c_str());
-            if (ellipsedWidth < width)
-            {
-                // Keep best string with ellipse
-                bestString = ellipseString;
-            }
-            else
-            {
-                strcpy(string, bestString.c_str());
-                return getStringWidth(string);
-            }
+            return advances['.' - 32] * 3;
         }
-        return getStringWidth(string);
-    }
-
-    /**
-     * 0x00495685
-     *
-     * @param buffer @<esi>
-     * @return width @<cx>
-     */
-    uint16_t getStringWidth(const char* buffer)
-    {
-        uint16_t width = 0;
-        const uint8_t* str = reinterpret_cast<const uint8_t*>(buffer);
-        int16_t fontSpriteBase = _currentFontSpriteBase;
 
-        while (*str != (uint8_t)0)
+        // Measures the character at str, returning the character after it and its arguments.
+        // Only the maximum line width treats newline_x_y as starting a new line.
+        template<bool TNewLineXY>
+        const uint8_t* measure(const uint8_t* str)
         {
             const uint8_t chr = *str;
             str++;
 
             if (chr >= 32)
             {
-                width += _characterWidths[chr - 32 + fontSpriteBase];
-                continue;
+                width += advances[chr - 32];
+                return str;
             }
 
             switch (chr)
             {
                 case ControlCodes::move_x:
+                    maxWidth = std::max(width, maxWidth);
                     width = *str;
                     str++;
                     break;
@@ -402,22 +323,22 @@ namespace OpenLoco::Gfx
 
                 case ControlCodes::newline:
                 case ControlCodes::newline_smaller:
-                    continue;
+                    break;
 
                 case ControlCodes::font_small:
-                    fontSpriteBase = Font::small;
+                    setFont(Font::small);
                     break;
 
                 case ControlCodes::font_large:
-                    fontSpriteBase = Font::large;
+                    setFont(Font::large);
                     break;
 
                 case ControlCodes::font_bold:
-                    fontSpriteBase = Font::medium_bold;
+                    setFont(Font::medium_bold);
                     break;
 
                 case ControlCodes::font_regular:
-                    fontSpriteBase = Font::medium_normal;
+                    setFont(Font::medium_normal);
                     break;
 
                 case ControlCodes::outline:
@@ -430,7 +351,8 @@ namespace OpenLoco::Gfx
 
                 case ControlCodes::inline_sprite_str:
                 {
-                    const uint32_t image = reinterpret_cast<const uint32_t*>(str)[0];
+                    uint32_t image;
+                    std::memcpy(&image, str, sizeof(image));
                     const uint32_t imageId = image & 0x7FFFF;
                     str += 4;
                     width += _g1Elements[imageId].width;
@@ -438,7 +360,13 @@ namespace OpenLoco::Gfx
                 }
 
                 default:
-                    if (chr <= 0x16)
+                    if (TNewLineXY && chr == ControlCodes::newline_x_y)
+                    {
+                        maxWidth = std::max(width, maxWidth);
+                        width = *str;
+                        str += 2;
+                    }
+                    else if (chr <= 0x16)
                     {
                         str += 2;
                     }
@@ -448,9 +376,68 @@ namespace OpenLoco::Gfx
                     }
                     break;
             }
+            return str;
+        }
+    };
+
+    // 0x004957C4
+    // Clips the string so that it fits within width with an ellipsis on the end, in a single pass.
+    int16_t clipString(int16_t width, char* string)
+    {
+        if (width < 6)
+        {
+            *string = '\0';
+            return 0;
         }
 
-        return width;
+        // If width of the full string is less than allowed width then we don't need to clip
+        auto clippedWidth = getStringWidth(string);
+        if (clippedWidth <= width)
+        {
+            return clippedWidth;
+        }
+
+        // Find the longest prefix that still fits with an ellipsis on the end
+        auto* str = reinterpret_cast<const uint8_t*>(string);
+        TextMeasurement measurement(_currentFontSpriteBase);
+        size_t bestLength = 0;
+        uint16_t bestWidth = 0;
+        while (*str != 0)
+        {
+            str = measurement.measure<false>(str);
+
+            uint16_t ellipsedWidth = measurement.width + measurement.getEllipsisWidth();
+            if (ellipsedWidth >= width)
+            {
+                if (bestLength == 0)
+                {
+                    *string = '\0';
+                    return 0;
+                }
+                std::strcpy(string + bestLength, "...");
+                return bestWidth;
+            }
+            bestLength = reinterpret_cast<const char*>(str) - string;
+            bestWidth = ellipsedWidth;
+        }
+        return clippedWidth;
+    }
+
+    /**
+     * 0x00495685
+     *
+     * @param buffer @<esi>
+     * @return width @<cx>
+     */
+    uint16_t getStringWidth(const char* buffer)
+    {
+        auto* str = reinterpret_cast<const uint8_t*>(buffer);
+        TextMeasurement measurement(_currentFontSpriteBase);
+        while (*str != 0)
+        {
+            str = measurement.measure<false>(str);
+        }
+        return measurement.width;
     }
 
     /**
@@ -461,93 +448,13 @@ namespace OpenLoco::Gfx
      */
     uint16_t getMaxStringWidth(const char* buffer)
     {
-        uint16_t width = 0;
-        uint16_t maxWidth = 0;
-        const uint8_t* str = reinterpret_cast<const uint8_t*>(buffer);
-        int16_t fontSpriteBase = _currentFontSpriteBase;
-
-        while (*str != (uint8_t)0)
+        auto* str = reinterpret_cast<const uint8_t*>(buffer);
+        TextMeasurement measurement(_currentFontSpriteBase);
+        while (*str != 0)
         {
-            const uint8_t chr = *str;
-            str++;
-
-            if (chr >= 32)
-            {
-                width += _characterWidths[chr - 32 + fontSpriteBase];
-                continue;
-            }
-
-            switch (chr)
-            {
-                case ControlCodes::move_x:
-                    maxWidth = std::max(width, maxWidth);
-                    width = *str;
-                    str++;
-                    break;
-
-                case ControlCodes::adjust_palette:
-                case 3:
-                case 4:
-                    str++;
-                    break;
-
-                case ControlCodes::newline:
-                case ControlCodes::newline_smaller:
-                    continue;
-
-                case ControlCodes::font_small:
-                    fontSpriteBase = Font::small;
-                    break;
-
-                case ControlCodes::font_large:
-                    fontSpriteBase = Font::large;
-                    break;
-
-                case ControlCodes::font_bold:
-                    fontSpriteBase = Font::medium_bold;
-                    break;
-
-                case ControlCodes::font_regular:
-                    fontSpriteBase = Font::medium_normal;
-                    break;
-
-                case ControlCodes::outline:
-                case ControlCodes::outline_off:
-                case ControlCodes::window_colour_1:
-                case ControlCodes::window_colour_2:
-                case ControlCodes::window_colour_3:
-                case ControlCodes::window_colour_4:
-                    break;
-
-                case ControlCodes::newline_x_y:
-                    maxWidth = std::max(width, maxWidth);
-                    width = *str;
-                    str += 2;
-                    break;
-
-                case ControlCodes::inline_sprite_str:
-                {
-                    const uint32_t image = reinterpret_cast<const uint32_t*>(str)[0];
-                    const uint32_t imageId = image & 0x7FFFF;
-                    str += 4;
-                    width += _g1Elements[imageId].width;
-                    break;
-                }
-
-                default:
-                    if (chr <= 0x16)
-                    {
-                        str += 2;
-                    }
-                    else
-                    {
-                        str += 4;
-                    }
-                    break;
-            }
+            str = measurement.measure<true>(str);
         }
-        maxWidth = std::max(width, maxWidth);
-        return maxWidth;
+        return std::max(measurement.width, measurement.maxWidth);
     }
 
     static void setTextColours(PaletteIndex_t pal1, PaletteIndex_t pal2, PaletteIndex_t pal3)
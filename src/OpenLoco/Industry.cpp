@@ -1,4 +1,5 @@
 #include "Industry.h"
+#include "IndustryManager.h"
 #include "Interop/Interop.hpp"
 #include "Localisation/StringIds.h"
 #include "Map/AnimationManager.h"
@@ -136,17 +137,30 @@ namespace OpenLoco
     {
         if (!(flags & IndustryFlags::flag_01) && under_construction == 0xFF)
         {
-            // Run tile loop for 100 iterations
-            for (int i = 0; i < 100; i++)
+            // The tile loop advances 100 tiles per tick as before, but only the tiles owned by
+            // this industry are looked at
+            const auto loopTile = TilePos2(tile_loop.current());
+            const uint32_t start = loopTile.y * map_columns + loopTile.x;
+            const uint32_t end = std::min<uint32_t>(start + 100, map_size);
+
+            const auto& ownedTiles = IndustryManager::getOwnedTiles(id());
+            for (auto it = std::lower_bound(ownedTiles.begin(), ownedTiles.end(), start); it != ownedTiles.end() && *it < end; ++it)
             {
-                sub_45329B(tile_loop.current());
+                sub_45329B(TilePos2(*it % map_columns, *it / map_columns));
+            }
 
-                // loc_453318
-                if (tile_loop.next() == Pos2())
-                {
-                    sub_453354();
-                    break;
-                }
+            // loc_453318
+            if (end == map_size)
+            {
+                tile_loop.setCurrent(Pos2());
+#ifndef NDEBUG
+                IndustryManager::validateOwnedTiles(id());
+#endif
+                sub_453354();
+            }
+            else
+            {
+                tile_loop.setCurrent(TilePos2(end % map_columns, end / map_columns));
             }
         }
     }
@@ -230,6 +244,7 @@ namespace OpenLoco
         regs.dl = dl;
         regs.dh = id();
         call(0x00454A43, regs);
+        IndustryManager::rescanOwnedTiles(id());
     }
 
     // 0x00459D43
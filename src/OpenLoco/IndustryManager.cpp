@@ -1,10 +1,13 @@
 #include "IndustryManager.h"
 #include "CompanyManager.h"
+#include "Console.h"
 #include "Interop/Interop.hpp"
+#include "Map/TileManager.h"
 #include "Math/Vector.hpp"
 #include "Objects/IndustryObject.h"
 #include "OpenLoco.h"
 #include "Ui/WindowManager.h"
+#include <algorithm>
 
 using namespace OpenLoco::Interop;
 
@@ -20,6 +23,7 @@ namespace OpenLoco::IndustryManager
             industry.name = StringIds::null;
         }
         Ui::Windows::IndustryList::reset();
+        invalidateOwnedTiles();
     }
 
     LocoFixedVector<Industry> industries()
@@ -83,4 +87,137 @@ namespace OpenLoco::IndustryManager
 
         return false;
     }
+
+    // Fields are grown within 15 tiles of the industry and a patch reaches a few tiles further.
+    constexpr coord_t fieldAreaRadius = 24;
+
+    struct OwnedTiles
+    {
+        std::vector<uint32_t> tiles;
+        // The industry the tiles were found for; another industry in the same slot is rescanned
+        Map::Pos2 origin;
+        uint8_t objectId;
+        bool isFinished;
+    };
+
+    static std::array<OwnedTiles, max_industries> _ownedTiles;
+    static bool _isOwnedTilesValid = false;
+
+    static uint32_t getTileIndex(const Map::TilePos2& pos)
+    {
+        return pos.y * Map::map_columns + pos.x;
+    }
+
+    static bool isOwnedBy(const Map::SurfaceElement* surface, IndustryId_t id)
+    {
+        return surface != nullptr && surface->hasHighTypeFlag() && surface->industryId() == id;
+    }
+
+    static void setOrigin(OwnedTiles& entry, const Industry& industry)
+    {
+        entry.origin = Map::Pos2(industry.x, industry.y);
+        entry.objectId = industry.object_id;
+        entry.isFinished = industry.under_construction == 0xFF;
+    }
+
+    static void rebuildOwnedTiles()
+    {
+        for (auto& entry : _ownedTiles)
+        {
+            entry.tiles.clear();
+        }
+
+        for (coord_t y = 0; y < Map::map_rows; y++)
+        {
+            for (coord_t x = 0; x < Map::map_columns; x++)
+            {
+                const auto pos = Map::TilePos2(x, y);
+                auto surface = Map::TileManager::get(pos).surface();
+                if (surface == nullptr || !surface->hasHighTypeFlag() || surface->industryId() >= max_industries)
+                    continue;
+
+                _ownedTiles[surface->industryId()].tiles.push_back(getTileIndex(pos));
+            }
+        }
+
+        for (auto& industry : industries())
+        {
+            setOrigin(_ownedTiles[industry.id()], industry);
+        }
+        _isOwnedTilesValid = true;
+    }
+
+    const std::vector<uint32_t>& getOwnedTiles(IndustryId_t id)
+    {
+        if (!_isOwnedTilesValid)
+        {
+            rebuildOwnedTiles();
+        }
+
+        // Industries are built by the original code, which places their first fields
+        const auto& industry = _industries[id];
+        auto& entry = _ownedTiles[id];
+        if (entry.origin != Map::Pos2(industry.x, industry.y) || entry.objectId != industry.object_id || entry.isFinished != (industry.under_construction == 0xFF))
+        {
+            entry.tiles.clear();
+            rescanOwnedTiles(id);
+        }
+        return entry.tiles;
+    }
+
+    // Adds the tiles the industry has gained around it, such as newly grown fields.
+    void rescanOwnedTiles(IndustryId_t id)
+    {
+        if (!_isOwnedTilesValid)
+            return;
+
+        const auto& industry = _industries[id];
+        auto& entry = _ownedTiles[id];
+        const auto centre = Map::TilePos2(Map::Pos2(industry.x, industry.y));
+        const auto minX = std::max<coord_t>(centre.x - fieldAreaRadius, 0);
+        const auto minY = std::max<coord_t>(centre.y - fieldAreaRadius, 0);
+        const auto maxX = std::min<coord_t>(centre.x + fieldAreaRadius, Map::map_columns - 1);
+        const auto maxY = std::min<coord_t>(centre.y + fieldAreaRadius, Map::map_rows - 1);
+        for (coord_t y = minY; y <= maxY; y++)
+        {
+            for (coord_t x = minX; x <= maxX; x++)
+            {
+                const auto pos = Map::TilePos2(x, y);
+                if (isOwnedBy(Map::TileManager::get(pos).surface(), id))
+                {
+                    entry.tiles.push_back(getTileIndex(pos));
+                }
+            }
+        }
+
+        std::sort(entry.tiles.begin(), entry.tiles.end());
+        entry.tiles.erase(std::unique(entry.tiles.begin(), entry.tiles.end()), entry.tiles.end());
+        setOrigin(entry, industry);
+    }
+
+    void invalidateOwnedTiles()
+    {
+        _isOwnedTilesValid = false;
+    }
+
+#ifndef NDEBUG
+    // Checks every tile the industry owns is in the index, rebuilding it otherwise.
+    void validateOwnedTiles(IndustryId_t id)
+    {
+        const auto& tiles = getOwnedTiles(id);
+        for (coord_t y = 0; y < Map::map_rows; y++)
+        {
+            for (coord_t x = 0; x < Map::map_columns; x++)
+            {
+                const auto pos = Map::TilePos2(x, y);
+                if (isOwnedBy(Map::TileManager::get(pos).surface(), id) && !std::binary_search(tiles.begin(), tiles.end(), getTileIndex(pos)))
+                {
+                    Console::error("Owned tiles of industry %d are missing %d, %d", id, x, y);
+                    rebuildOwnedTiles();
+                    return;
+                }
+            }
+        }
+    }
+#endif
 }
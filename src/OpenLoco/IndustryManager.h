@@ -4,6 +4,7 @@
 #include "Industry.h"
 #include <array>
 #include <cstddef>
+#include <vector>
 
 namespace OpenLoco::IndustryManager
 {
@@ -16,4 +17,13 @@ namespace OpenLoco::IndustryManager
     void updateMonthly();
     void createAllMapAnimations();
     bool industryNearPosition(const Map::Pos2& position, uint32_t flags);
+
+    // Surface tiles owned by the industry as indices in tile loop order, ascending. May still
+    // contain tiles the industry has since lost, so ownership must be checked again.
+    const std::vector<uint32_t>& getOwnedTiles(IndustryId_t id);
+    void rescanOwnedTiles(IndustryId_t id);
+    void invalidateOwnedTiles();
+#ifndef NDEBUG
+    void validateOwnedTiles(IndustryId_t id);
+#endif
 }
@@ -504,6 +504,20 @@ namespace OpenLoco::Input
             }
         }
 
+        try
+        {
+            auto giantFileName = updateGiantScreenshot();
+            if (giantFileName)
+            {
+                *((const char**)(&_commonFormatArgs[0])) = giantFileName->c_str();
+                Windows::showError(StringIds::screenshot_saved_as, StringIds::null, false);
+            }
+        }
+        catch (const std::exception&)
+        {
+            Windows::showError(StringIds::screenshot_failed);
+        }
+
         edgeScroll();
 
         _keyModifier = _keyModifier & ~(KeyModifier::shift | KeyModifier::control | KeyModifier::unknown);
@@ -1,9 +1,14 @@
+#include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <cstdio>
 #include <cstring>
 #include <system_error>
 #ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 #include "../Audio/Audio.h"
@@ -36,6 +41,7 @@
 #include "../ViewportManager.h"
 #include "../Widget.h"
 #include "Interop.hpp"
+#include "MemoryTracker.h"
 
 using namespace OpenLoco;
 
@@ -51,6 +57,13 @@ using namespace OpenLoco;
 #error Unknown compiler, please define STDCALL and CDECL
 #endif
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#define RETURN_ADDRESS() reinterpret_cast<uintptr_t>(_ReturnAddress())
+#else
+#define RETURN_ADDRESS() reinterpret_cast<uintptr_t>(__builtin_return_address(0))
+#endif
+
 #pragma warning(push)
 // MSVC ignores C++17's [[maybe_unused]] attribute on functions, so just disable the warning
 #pragma warning(disable : 4505) // unreferenced local function has been removed.
@@ -186,37 +199,155 @@ static void CDECL fn_4081ad(int32_t wParam)
 
 ///endregion
 
+// A file opened by the original code. Files opened for reading are mapped into memory so that
+// seeks and reads need no system call. Files opened for writing, or that cannot be mapped, use stdio.
+class FileHandle
+{
+private:
+    FILE* _file = nullptr;
+    const uint8_t* _data = nullptr;
+    size_t _size = 0;
+    size_t _position = 0;
+
+public:
+    static FileHandle* openRead(const char* path)
+    {
+        auto fd = open(path, O_RDONLY);
+        if (fd == -1)
+            return nullptr;
+
+        auto handle = new FileHandle();
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+        {
+            handle->_size = static_cast<size_t>(st.st_size);
+            if (handle->_size == 0)
+            {
+                ::close(fd);
+                return handle;
+            }
+
+            auto data = mmap(nullptr, handle->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                ::close(fd);
+                handle->_data = static_cast<const uint8_t*>(data);
+                return handle;
+            }
+        }
+
+        handle->_file = fdopen(fd, "r");
+        if (handle->_file == nullptr)
+        {
+            ::close(fd);
+            delete handle;
+            return nullptr;
+        }
+        return handle;
+    }
+
+    static FileHandle* openWrite(const char* path)
+    {
+        auto file = fopen(path, "w");
+        if (file == nullptr)
+            return nullptr;
+
+        auto handle = new FileHandle();
+        handle->_file = file;
+        return handle;
+    }
+
+    // Returns the new position, which like fseek stays unchanged when the target is before the start.
+    uint32_t seek(int32_t distance, int origin)
+    {
+        if (_file != nullptr)
+        {
+            fseek(_file, distance, origin);
+            return ftell(_file);
+        }
+
+        int64_t base = 0;
+        if (origin == SEEK_CUR)
+        {
+            base = _position;
+        }
+        else if (origin == SEEK_END)
+        {
+            base = _size;
+        }
+        if (base + distance >= 0)
+        {
+            _position = static_cast<size_t>(base + distance);
+        }
+        return static_cast<uint32_t>(_position);
+    }
+
+    int32_t read(char* buffer, int32_t size)
+    {
+        if (_file != nullptr)
+        {
+            return fread(buffer, 1, size, _file);
+        }
+
+        if (size <= 0 || _position >= _size)
+            return 0;
+
+        auto length = std::min<size_t>(size, _size - _position);
+        std::memcpy(buffer, _data + _position, length);
+        _position += length;
+        return static_cast<int32_t>(length);
+    }
+
+    size_t write(const char* buffer, size_t size)
+    {
+        if (_file == nullptr)
+            return 0;
+
+        return fwrite(buffer, 1, size, _file);
+    }
+
+    bool close()
+    {
+        bool result = true;
+        if (_data != nullptr)
+        {
+            result = munmap(const_cast<uint8_t*>(_data), _size) == 0;
+        }
+        if (_file != nullptr)
+        {
+            result = fclose(_file) == 0;
+        }
+        delete this;
+        return result;
+    }
+};
+
 FORCE_ALIGN_ARG_POINTER
-static uint32_t CDECL fn_FileSeekSet(FILE* a0, int32_t distance)
+static uint32_t CDECL fn_FileSeekSet(FileHandle* a0, int32_t distance)
 {
     Console::logVerbose("seek %d bytes from start", distance);
-    fseek(a0, distance, SEEK_SET);
-    return ftell(a0);
+    return a0->seek(distance, SEEK_SET);
 }
 
 FORCE_ALIGN_ARG_POINTER
-static uint32_t CDECL fn_FileSeekFromCurrent(FILE* a0, int32_t distance)
+static uint32_t CDECL fn_FileSeekFromCurrent(FileHandle* a0, int32_t distance)
 {
     Console::logVerbose("seek %d bytes from current", distance);
-    fseek(a0, distance, SEEK_CUR);
-    return ftell(a0);
+    return a0->seek(distance, SEEK_CUR);
 }
 
 FORCE_ALIGN_ARG_POINTER
-static uint32_t CDECL fn_FileSeekFromEnd(FILE* a0, int32_t distance)
+static uint32_t CDECL fn_FileSeekFromEnd(FileHandle* a0, int32_t distance)
 {
     Console::logVerbose("seek %d bytes from end", distance);
-    fseek(a0, distance, SEEK_END);
-    return ftell(a0);
+    return a0->seek(distance, SEEK_END);
 }
 
 FORCE_ALIGN_ARG_POINTER
-static int32_t CDECL fn_FileRead(FILE* a0, char* buffer, int32_t size)
+static int32_t CDECL fn_FileRead(FileHandle* a0, char* buffer, int32_t size)
 {
-    Console::logVerbose("read %d bytes (%d)", size, fileno(a0));
-    size = fread(buffer, 1, size, a0);
-
-    return size;
+    Console::logVerbose("read %d bytes", size);
+    return a0->read(buffer, size);
 }
 
 typedef struct FindFileData
@@ -233,34 +364,99 @@ typedef struct FindFileData
     char cAlternateFileName[14];
 } FindFileData;
 
+#define FILE_ATTRIBUTE_DIRECTORY 0x10
+#define INVALID_HANDLE_VALUE reinterpret_cast<Session*>(-1)
+
+// Difference between the FILETIME epoch (1601) and the unix epoch in seconds
+constexpr uint64_t fileTimeUnixEpoch = 11644473600ULL;
+
+// A directory listing for the original file search. Entries matching the search pattern are
+// read once when the search starts and handed out in order.
 class Session
 {
 public:
-    std::vector<fs::path> fileList;
+    struct Entry
+    {
+        std::string name;
+        bool isDirectory;
+        uint64_t size;
+        uint64_t lastWriteTime; // FILETIME, 100 ns intervals since 1601
+    };
+
+    std::vector<Entry> entries;
+    size_t next = 0;
 };
 
-#define FILE_ATTRIBUTE_DIRECTORY 0x10
-
-FORCE_ALIGN_ARG_POINTER
-static Session* CDECL fn_FindFirstFile(char* lpFileName, FindFileData* out)
+// Matches a name against a Win32 style pattern of * and ?, ignoring case. As on Windows, *.* also
+// matches names without a dot.
+static bool matchFilePattern(const char* pattern, const char* name)
 {
-    Console::logVerbose("%s (%s)", __FUNCTION__, lpFileName);
+    if (std::strcmp(pattern, "*.*") == 0)
+        return true;
 
-    Session* data = new Session;
+    const char* starPattern = nullptr;
+    const char* starName = nullptr;
+    while (*name != '\0')
+    {
+        if (*pattern == '*')
+        {
+            starPattern = ++pattern;
+            starName = name;
+        }
+        else if (*pattern == '?' || std::tolower(static_cast<unsigned char>(*pattern)) == std::tolower(static_cast<unsigned char>(*name)))
+        {
+            pattern++;
+            name++;
+        }
+        else if (starPattern != nullptr)
+        {
+            pattern = starPattern;
+            name = ++starName;
+        }
+        else
+        {
+            return false;
+        }
+    }
 
-    fs::path path = lpFileName;
-    path.remove_filename();
+    while (*pattern == '*')
+    {
+        pattern++;
+    }
+    return *pattern == '\0';
+}
 
-    fs::directory_iterator iter(path), end;
+static void readDirectory(Session& session, const std::string& directory, const std::string& pattern)
+{
+    auto dir = opendir(directory.empty() ? "." : directory.c_str());
+    if (dir == nullptr)
+        return;
 
-    while (iter != end)
+    while (auto ent = readdir(dir))
     {
-        data->fileList.push_back(iter->path());
-        ++iter;
+        if (std::strcmp(ent->d_name, ".") == 0 || std::strcmp(ent->d_name, "..") == 0)
+            continue;
+
+        if (!matchFilePattern(pattern.c_str(), ent->d_name))
+            continue;
+
+        Session::Entry entry{ ent->d_name, ent->d_type == DT_DIR, 0, 0 };
+        struct stat st;
+        if (fstatat(dirfd(dir), ent->d_name, &st, 0) == 0)
+        {
+            entry.isDirectory = S_ISDIR(st.st_mode);
+            entry.size = static_cast<uint64_t>(st.st_size);
+            entry.lastWriteTime = (static_cast<uint64_t>(st.st_mtime) + fileTimeUnixEpoch) * 10000000ULL;
+        }
+        session.entries.push_back(std::move(entry));
     }
+    closedir(dir);
+}
 
-    Utility::strcpy_safe(out->cFilename, data->fileList[0].filename().u8string().c_str());
-    if (fs::is_directory(data->fileList[0]))
+static void setFindFileData(const Session::Entry& entry, FindFileData* out)
+{
+    Utility::strcpy_safe(out->cFilename, entry.name.c_str());
+    if (entry.isDirectory)
     {
         out->dwFileAttributes = FILE_ATTRIBUTE_DIRECTORY;
     }
@@ -268,8 +464,30 @@ static Session* CDECL fn_FindFirstFile(char* lpFileName, FindFileData* out)
     {
         out->dwFileAttributes &= ~FILE_ATTRIBUTE_DIRECTORY;
     }
+    out->nFileSizeHigh = static_cast<uint32_t>(entry.size >> 32);
+    out->nFileSizeLow = static_cast<uint32_t>(entry.size);
+    out->ftLastWriteTime[0] = static_cast<uint32_t>(entry.lastWriteTime);
+    out->ftLastWriteTime[1] = static_cast<uint32_t>(entry.lastWriteTime >> 32);
+}
+
+FORCE_ALIGN_ARG_POINTER
+static Session* CDECL fn_FindFirstFile(char* lpFileName, FindFileData* out)
+{
+    Console::logVerbose("%s (%s)", __FUNCTION__, lpFileName);
 
-    data->fileList.erase(data->fileList.begin());
+    fs::path path = lpFileName;
+    auto pattern = path.filename().u8string();
+    path.remove_filename();
+
+    auto data = new Session;
+    readDirectory(*data, path.u8string(), pattern);
+    if (data->entries.empty())
+    {
+        delete data;
+        return INVALID_HANDLE_VALUE;
+    }
+
+    setFindFileData(data->entries[data->next++], out);
     return data;
 }
 
@@ -277,23 +495,12 @@ static bool CDECL fn_FindNextFile(Session* data, FindFileData* out)
 {
     STUB();
 
-    if (data->fileList.size() == 0)
+    if (data->next >= data->entries.size())
     {
         return false;
     }
 
-    Utility::strcpy_safe(out->cFilename, data->fileList[0].filename().u8string().c_str());
-    if (fs::is_directory(data->fileList[0]))
-    {
-        out->dwFileAttributes = FILE_ATTRIBUTE_DIRECTORY;
-    }
-    else
-    {
-        out->dwFileAttributes &= ~FILE_ATTRIBUTE_DIRECTORY;
-    }
-
-    data->fileList.erase(data->fileList.begin());
-
+    setFindFileData(data->entries[data->next++], out);
     return true;
 }
 
@@ -301,7 +508,10 @@ static void CDECL fn_FindClose(Session* data)
 {
     STUB();
 
-    delete data;
+    if (data != INVALID_HANDLE_VALUE)
+    {
+        delete data;
+    }
 }
 #endif // _NO_LOCO_WIN32_
 
@@ -353,6 +563,24 @@ static void CDECL fn_free(void* block)
     return free(block);
 }
 
+FORCE_ALIGN_ARG_POINTER
+static void* CDECL fn_mallocTracked(uint32_t size)
+{
+    return Interop::MemoryTracker::allocate(size, RETURN_ADDRESS());
+}
+
+FORCE_ALIGN_ARG_POINTER
+static void* CDECL fn_reallocTracked(void* block, uint32_t size)
+{
+    return Interop::MemoryTracker::reallocate(block, size, RETURN_ADDRESS());
+}
+
+FORCE_ALIGN_ARG_POINTER
+static void CDECL fn_freeTracked(void* block)
+{
+    Interop::MemoryTracker::release(block, RETURN_ADDRESS());
+}
+
 #ifdef _NO_LOCO_WIN32_
 static void STDCALL fn_dump(uint32_t address)
 {
@@ -401,13 +629,13 @@ static bool STDCALL lib_DeleteFileA(char* lpFileName)
 
 FORCE_ALIGN_ARG_POINTER
 static bool STDCALL lib_WriteFile(
-    FILE* hFile,
+    FileHandle* hFile,
     char* buffer,
     size_t nNumberOfBytesToWrite,
     uint32_t* lpNumberOfBytesWritten,
     uintptr_t lpOverlapped)
 {
-    *lpNumberOfBytesWritten = fwrite(buffer, 1, nNumberOfBytesToWrite, hFile);
+    *lpNumberOfBytesWritten = hFile->write(buffer, nNumberOfBytesToWrite);
     Console::logVerbose("WriteFile(%s)", buffer);
 
     return true;
@@ -434,26 +662,26 @@ static int32_t STDCALL lib_CreateFileA(
 {
     Console::logVerbose("CreateFile(%s, 0x%x, 0x%x)", lpFileName, dwDesiredAccess, dwCreationDisposition);
 
-    FILE* pFILE = nullptr;
+    FileHandle* handle = nullptr;
     if (dwDesiredAccess == GENERIC_READ && dwCreationDisposition == OPEN_EXISTING)
     {
-        pFILE = fopen(lpFileName, "r");
+        handle = FileHandle::openRead(lpFileName);
     }
     else if (dwDesiredAccess == GENERIC_WRITE && dwCreationDisposition == CREATE_ALWAYS)
     {
-        pFILE = fopen(lpFileName, "w");
+        handle = FileHandle::openWrite(lpFileName);
     }
     else
     {
         assert(false);
     }
 
-    if (pFILE == nullptr)
+    if (handle == nullptr)
     {
         return -1;
     }
 
-    return (int32_t)pFILE;
+    return (int32_t)handle;
 }
 
 FORCE_ALIGN_ARG_POINTER
@@ -484,9 +712,9 @@ static void* STDCALL lib_CreateMutexA(uintptr_t lmMutexAttributes, bool bInitial
 FORCE_ALIGN_ARG_POINTER
 static bool STDCALL lib_CloseHandle(void* hObject)
 {
-    auto file = (FILE*)hObject;
+    auto file = (FileHandle*)hObject;
 
-    return fclose(file) == 0;
+    return file->close();
 }
 
 FORCE_ALIGN_ARG_POINTER
@@ -504,9 +732,19 @@ static void registerMemoryHooks()
 
     // Hook Locomotion's alloc / free routines so that we don't
     // allocate a block in one module and freeing it in another.
-    writeJmp(0x4d1401, (void*)&fn_malloc);
-    writeJmp(0x4D1B28, (void*)&fn_realloc);
-    writeJmp(0x4D1355, (void*)&fn_free);
+    MemoryTracker::initialise();
+    if (MemoryTracker::isEnabled())
+    {
+        writeJmp(0x4d1401, (void*)&fn_mallocTracked);
+        writeJmp(0x4D1B28, (void*)&fn_reallocTracked);
+        writeJmp(0x4D1355, (void*)&fn_freeTracked);
+    }
+    else
+    {
+        writeJmp(0x4d1401, (void*)&fn_malloc);
+        writeJmp(0x4D1B28, (void*)&fn_realloc);
+        writeJmp(0x4D1355, (void*)&fn_free);
+    }
 }
 
 #ifdef _NO_LOCO_WIN32_
@@ -910,6 +1148,50 @@ void OpenLoco::Interop::registerHooks()
             auto* entity = reinterpret_cast<EntityBase*>(regs.esi);
             EntityManager::freeEntity(entity);
 
+            regs = backup;
+            return 0;
+        });
+
+    // The entity creation of the original code goes through these too, so that running out of
+    // entities is reported whoever asked. The new entity is returned in esi, or null with carry set.
+    registerHook(
+        0x004700A5,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            auto* entity = EntityManager::createEntityMisc();
+            regs = backup;
+            regs.esi = X86Pointer(entity);
+            return entity != nullptr ? 0 : X86_FLAG_CARRY;
+        });
+
+    registerHook(
+        0x00470039,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            auto* entity = EntityManager::createEntityVehicle();
+            regs = backup;
+            regs.esi = X86Pointer(entity);
+            return entity != nullptr ? 0 : X86_FLAG_CARRY;
+        });
+
+    registerHook(
+        0x0047011C,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            auto* entity = EntityManager::createEntityMoney();
+            regs = backup;
+            regs.esi = X86Pointer(entity);
+            return entity != nullptr ? 0 : X86_FLAG_CARRY;
+        });
+
+    registerHook(
+        0x0046FC83,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+
+            auto* entity = reinterpret_cast<EntityBase*>(regs.esi);
+            entity->moveTo({ regs.ax, regs.cx, regs.dx });
+
             regs = backup;
             return 0;
         });
@@ -0,0 +1,186 @@
+#include "MemoryTracker.h"
+#include "../Console.h"
+#include "../Core/FileSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenLoco::Interop::MemoryTracker
+{
+    struct CallerStats
+    {
+        uint64_t liveBytes;
+        uint64_t peakBytes;
+        uint32_t liveBlocks;
+        uint32_t allocations;
+        uint32_t reallocations;
+        uint32_t frees;
+    };
+
+    struct Block
+    {
+        uint32_t size;
+        uintptr_t caller;
+    };
+
+    static bool _isEnabled = false;
+    static fs::path _statsPath;
+
+    // The original code only allocates on the main thread, but the lock keeps the accounting
+    // safe should that change.
+    static std::mutex _mutex;
+
+    // Blocks are kept in a side table rather than behind a header, as C++ code frees some blocks
+    // the original code allocated and the other way round.
+    static std::unordered_map<void*, Block> _blocks;
+    static std::unordered_map<uintptr_t, CallerStats> _callers;
+    static uint64_t _liveBytes;
+    static uint64_t _peakBytes;
+    static uint32_t _unknownFrees;
+    static std::chrono::steady_clock::duration _trackingTime;
+
+    void initialise()
+    {
+        auto path = std::getenv("OPENLOCO_MEMORY_STATS");
+        if (path != nullptr && path[0] != '\0')
+        {
+            _statsPath = fs::u8path(path);
+            _isEnabled = true;
+            Console::log("Tracking memory allocated by the original code, statistics are written to %s", path);
+        }
+    }
+
+    bool isEnabled()
+    {
+        return _isEnabled;
+    }
+
+    static void addBlock(void* block, uint32_t size, uintptr_t caller)
+    {
+        _blocks[block] = Block{ size, caller };
+
+        auto& stats = _callers[caller];
+        stats.liveBytes += size;
+        stats.liveBlocks++;
+        stats.peakBytes = std::max(stats.peakBytes, stats.liveBytes);
+
+        _liveBytes += size;
+        _peakBytes = std::max(_peakBytes, _liveBytes);
+    }
+
+    // Returns false for blocks not allocated through the tracker.
+    static bool removeBlock(void* block)
+    {
+        auto it = _blocks.find(block);
+        if (it == _blocks.end())
+            return false;
+
+        auto& stats = _callers[it->second.caller];
+        stats.liveBytes -= it->second.size;
+        stats.liveBlocks--;
+        _liveBytes -= it->second.size;
+        _blocks.erase(it);
+        return true;
+    }
+
+    void* allocate(uint32_t size, uintptr_t caller)
+    {
+        auto block = std::malloc(size);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto start = std::chrono::steady_clock::now();
+        if (block != nullptr)
+        {
+            addBlock(block, size, caller);
+        }
+        _callers[caller].allocations++;
+        _trackingTime += std::chrono::steady_clock::now() - start;
+        return block;
+    }
+
+    void* reallocate(void* block, uint32_t size, uintptr_t caller)
+    {
+        auto newBlock = std::realloc(block, size);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto start = std::chrono::steady_clock::now();
+        // A failed realloc leaves the block as it was, unless it was a free of the block
+        if (newBlock != nullptr || size == 0)
+        {
+            if (block != nullptr && !removeBlock(block))
+            {
+                _unknownFrees++;
+            }
+            if (newBlock != nullptr)
+            {
+                addBlock(newBlock, size, caller);
+            }
+        }
+        _callers[caller].reallocations++;
+        _trackingTime += std::chrono::steady_clock::now() - start;
+        return newBlock;
+    }
+
+    void release(void* block, uintptr_t caller)
+    {
+        if (block != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto start = std::chrono::steady_clock::now();
+            if (!removeBlock(block))
+            {
+                _unknownFrees++;
+            }
+            _callers[caller].frees++;
+            _trackingTime += std::chrono::steady_clock::now() - start;
+        }
+        std::free(block);
+    }
+
+    void dumpStats()
+    {
+        if (!_isEnabled)
+            return;
+
+        std::vector<std::pair<uintptr_t, CallerStats>> callers;
+        uint64_t liveBytes;
+        uint64_t peakBytes;
+        uint32_t unknownFrees;
+        int64_t trackingTimeUs;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            callers.assign(_callers.begin(), _callers.end());
+            liveBytes = _liveBytes;
+            peakBytes = _peakBytes;
+            unknownFrees = _unknownFrees;
+            trackingTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(_trackingTime).count();
+        }
+
+        std::sort(callers.begin(), callers.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second.liveBytes != rhs.second.liveBytes ? lhs.second.liveBytes > rhs.second.liveBytes : lhs.second.peakBytes > rhs.second.peakBytes;
+        });
+
+        std::ofstream stream(_statsPath, std::ios::out | std::ios::trunc);
+        if (!stream.is_open())
+        {
+            Console::error("Unable to write memory statistics to %s", _statsPath.u8string().c_str());
+            return;
+        }
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "live bytes: %llu\npeak bytes: %llu\nfrees of unknown blocks: %u\ntracking time: %lld us\n\n", static_cast<unsigned long long>(liveBytes), static_cast<unsigned long long>(peakBytes), unknownFrees, static_cast<long long>(trackingTimeUs));
+        stream << line;
+        std::snprintf(line, sizeof(line), "%-10s %12s %12s %8s %10s %10s %10s\n", "caller", "live bytes", "peak bytes", "blocks", "allocs", "reallocs", "frees");
+        stream << line;
+        for (const auto& [caller, stats] : callers)
+        {
+            std::snprintf(line, sizeof(line), "0x%08X %12llu %12llu %8u %10u %10u %10u\n", static_cast<uint32_t>(caller), static_cast<unsigned long long>(stats.liveBytes), static_cast<unsigned long long>(stats.peakBytes), stats.liveBlocks, stats.allocations, stats.reallocations, stats.frees);
+            stream << line;
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+// Opt-in accounting of the memory the original code allocates through its malloc, realloc and
+// free. Blocks are charged to the address that called the allocator. Enabled by setting
+// OPENLOCO_MEMORY_STATS to the file the statistics are written to.
+namespace OpenLoco::Interop::MemoryTracker
+{
+    void initialise();
+    bool isEnabled();
+
+    void* allocate(uint32_t size, uintptr_t caller);
+    void* reallocate(void* block, uint32_t size, uintptr_t caller);
+    void release(void* block, uintptr_t caller);
+
+    // Writes the statistics to the file given in the environment, does nothing when disabled.
+    void dumpStats();
+}
@@ -251,6 +251,7 @@ namespace OpenLoco::Localisation
                 if (processed_string != nullptr)
                 {
                     _strings[id] = processed_string;
+                    StringManager::compileString(id);
                 }
             }
 
@@ -285,6 +286,7 @@ namespace OpenLoco::Localisation
 
     void unloadLanguageFile()
     {
+        StringManager::clearCompiledStrings();
         _strings_owner.clear();
     }
 }
@@ -15,6 +15,7 @@
 #include <cstring>
 #include <map>
 #include <stdexcept>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -245,294 +246,326 @@ namespace OpenLoco::StringManager
 
     static char* formatString(char* buffer, string_id id, ArgsWrapper& args);
 
-    static char* formatStringPart(char* buffer, const char* sourceStr, ArgsWrapper& args)
+    // Number of bytes copied verbatim for a character, or 0 if it formats an argument.
+    static size_t getLiteralLength(uint8_t ch)
     {
-        while (true)
+        if (ch <= 4)
+            return 2;
+        if (ch <= 16)
+            return 1;
+        if (ch <= 22)
+            return 3;
+        if (ch <= 0x1F)
+            return 5;
+        if (ch < 0x7B || ch >= 0x90)
+            return 1;
+        return 0;
+    }
+
+    // Number of bytes following an argument control code in the source string.
+    static size_t getOperandLength(uint8_t code)
+    {
+        switch (code)
         {
-            uint8_t ch = *sourceStr;
+            case ControlCodes::stringid_str:
+                return 2;
+            case ControlCodes::date:
+                return 1;
+            default:
+                return 0;
+        }
+    }
 
-            if (ch == 0)
+    static uint16_t readOperand(uint8_t code, const char* sourceStr)
+    {
+        switch (code)
+        {
+            case ControlCodes::stringid_str:
             {
-                *buffer = '\0';
-                return buffer;
+                string_id id;
+                std::memcpy(&id, sourceStr, sizeof(id));
+                return id;
             }
-            else if (ch <= 4)
+            case ControlCodes::date:
+                return static_cast<uint8_t>(*sourceStr);
+            default:
+                return 0;
+        }
+    }
+
+    // Formats one argument control code. The operand is the string id of stringid_str or the
+    // modifier of date, read from the source string.
+    static char* formatControlCode(char* buffer, uint8_t code, uint16_t operand, ArgsWrapper& args)
+    {
+        switch (code)
+        {
+            case ControlCodes::int32_grouped:
             {
-                std::memcpy(buffer, sourceStr, 2);
-                buffer += 2;
-                sourceStr += 2;
+                int32_t value = args.pop<int32_t>();
+                buffer = formatInt32Grouped(value, buffer);
+                break;
             }
-            else if (ch <= 16)
+
+            case ControlCodes::int32_ungrouped:
             {
-                std::memcpy(buffer, sourceStr, 1);
-                buffer += 1;
-                sourceStr += 1;
+                int32_t value = args.pop<int32_t>();
+                buffer = formatInt32Ungrouped(value, buffer);
+                break;
             }
-            else if (ch <= 22)
+
+            case ControlCodes::int16_decimals:
             {
-                std::memcpy(buffer, sourceStr, 3);
-                buffer += 3;
-                sourceStr += 3;
+                int16_t value = args.pop<int16_t>();
+                buffer = formatShortWithDecimals(value, buffer);
+                break;
             }
-            else if (ch <= 0x1F)
+
+            case ControlCodes::int32_decimals:
             {
-                std::memcpy(buffer, sourceStr, 5);
-                buffer += 5;
-                sourceStr += 5;
+                int32_t value = args.pop<int32_t>();
+                buffer = formatIntWithDecimals(value, buffer);
+                break;
             }
-            else if (ch < 0x7B || ch >= 0x90)
+
+            case ControlCodes::int16_grouped:
             {
-                std::memcpy(buffer, sourceStr, 1);
-                buffer += 1;
-                sourceStr += 1;
+                int16_t value = args.pop<int16_t>();
+                buffer = formatInt32Grouped(value, buffer);
+                break;
             }
-            else
+
+            case ControlCodes::uint16_ungrouped:
             {
-                sourceStr++;
+                int32_t value = args.pop<uint16_t>();
+                buffer = formatInt32Ungrouped(value, buffer);
+                break;
+            }
 
-                switch (ch)
-                {
-                    case ControlCodes::int32_grouped:
-                    {
-                        int32_t value = args.pop<int32_t>();
-                        buffer = formatInt32Grouped(value, buffer);
-                        break;
-                    }
+            case ControlCodes::currency32:
+            {
+                int32_t value = args.pop<uint32_t>();
+                buffer = formatCurrency(value, buffer);
+                break;
+            }
 
-                    case ControlCodes::int32_ungrouped:
-                    {
-                        int32_t value = args.pop<int32_t>();
-                        buffer = formatInt32Ungrouped(value, buffer);
-                        break;
-                    }
+            case ControlCodes::currency48:
+            {
+                uint32_t value_low = args.pop<uint32_t>();
+                int32_t value_high = args.pop<int16_t>();
+                int64_t value = (value_high * (1ULL << 32)) | value_low;
+                buffer = formatCurrency(value, buffer);
+                break;
+            }
 
-                    case ControlCodes::int16_decimals:
-                    {
-                        int16_t value = args.pop<int16_t>();
-                        buffer = formatShortWithDecimals(value, buffer);
-                        break;
-                    }
+            case ControlCodes::stringid_args:
+            {
+                string_id id = args.pop<string_id>();
+                buffer = formatString(buffer, id, args);
+                break;
+            }
 
-                    case ControlCodes::int32_decimals:
-                    {
-                        int32_t value = args.pop<int32_t>();
-                        buffer = formatIntWithDecimals(value, buffer);
-                        break;
-                    }
+            case ControlCodes::stringid_str:
+            {
+                buffer = formatString(buffer, operand, args);
+                break;
+            }
 
-                    case ControlCodes::int16_grouped:
-                    {
-                        int16_t value = args.pop<int16_t>();
-                        buffer = formatInt32Grouped(value, buffer);
-                        break;
-                    }
+            case ControlCodes::string_ptr:
+            {
+                const char* str = args.pop<const char*>();
+                strcpy(buffer, str);
+                buffer += strlen(str);
+                break;
+            }
 
-                    case ControlCodes::uint16_ungrouped:
-                    {
-                        int32_t value = args.pop<uint16_t>();
-                        buffer = formatInt32Ungrouped(value, buffer);
-                        break;
-                    }
+            case ControlCodes::date:
+            {
+                auto modifier = static_cast<uint8_t>(operand);
+                uint32_t totalDays = args.pop<uint32_t>();
 
-                    case ControlCodes::currency32:
-                    {
-                        int32_t value = args.pop<uint32_t>();
-                        buffer = formatCurrency(value, buffer);
-                        break;
-                    }
-
-                    case ControlCodes::currency48:
-                    {
-                        uint32_t value_low = args.pop<uint32_t>();
-                        int32_t value_high = args.pop<int16_t>();
-                        int64_t value = (value_high * (1ULL << 32)) | value_low;
-                        buffer = formatCurrency(value, buffer);
+                switch (modifier)
+                {
+                    case DateModifier::dmy_full:
+                        buffer = formatDateDMYFull(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::stringid_args:
-                    {
-                        string_id id = args.pop<string_id>();
-                        buffer = formatString(buffer, id, args);
+                    case DateModifier::my_full:
+                        buffer = formatDateMYFull(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::stringid_str:
-                    {
-                        string_id id = *(string_id*)sourceStr;
-                        sourceStr += 2;
-                        buffer = formatString(buffer, id, args);
+                    case DateModifier::my_abbr:
+                        buffer = formatDateMYAbbrev(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::string_ptr:
-                    {
-                        const char* str = args.pop<const char*>();
-                        strcpy(buffer, str);
-                        buffer += strlen(str);
+                    case DateModifier::raw_my_abbr:
+                        buffer = formatRawDateMYAbbrev(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::date:
-                    {
-                        char modifier = *sourceStr;
-                        uint32_t totalDays = args.pop<uint32_t>();
-                        sourceStr++;
+                    default:
+                        throw std::out_of_range("formatString: unexpected modifier: " + std::to_string((uint8_t)modifier));
+                }
 
-                        switch (modifier)
-                        {
-                            case DateModifier::dmy_full:
-                                buffer = formatDateDMYFull(totalDays, buffer);
-                                break;
+                break;
+            }
 
-                            case DateModifier::my_full:
-                                buffer = formatDateMYFull(totalDays, buffer);
-                                break;
+            case ControlCodes::velocity:
+            {
+                auto measurement_format = Config::get().measurement_format;
 
-                            case DateModifier::my_abbr:
-                                buffer = formatDateMYAbbrev(totalDays, buffer);
-                                break;
+                int32_t value = args.pop<int16_t>();
 
-                            case DateModifier::raw_my_abbr:
-                                buffer = formatRawDateMYAbbrev(totalDays, buffer);
-                                break;
+                const char* unit;
+                if (measurement_format == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_mph);
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_kmh);
+                    value = std::round(value * 1.609375);
+                }
 
-                            default:
-                                throw std::out_of_range("formatString: unexpected modifier: " + std::to_string((uint8_t)modifier));
-                        }
+                buffer = formatInt32Grouped(value, buffer);
 
-                        break;
-                    }
+                strcpy(buffer, unit);
+                buffer += strlen(unit);
 
-                    case ControlCodes::velocity:
-                    {
-                        auto measurement_format = Config::get().measurement_format;
+                break;
+            }
 
-                        int32_t value = args.pop<int16_t>();
+            case ControlCodes::pop16:
+                args.skip<uint16_t>();
+                break;
 
-                        const char* unit;
-                        if (measurement_format == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_mph);
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_kmh);
-                            value = std::round(value * 1.609375);
-                        }
+            case ControlCodes::push16:
+                args.push<uint16_t>();
+                break;
 
-                        buffer = formatInt32Grouped(value, buffer);
+            case ControlCodes::timeMS:
+                throw std::runtime_error("Unimplemented format string: 15");
 
-                        strcpy(buffer, unit);
-                        buffer += strlen(unit);
+            case ControlCodes::timeHM:
+                throw std::runtime_error("Unimplemented format string: 16");
 
-                        break;
-                    }
+            case ControlCodes::distance:
+            {
+                uint32_t value = args.pop<uint16_t>();
+                auto measurement_format = Config::get().measurement_format;
 
-                    case ControlCodes::pop16:
-                        args.skip<uint16_t>();
-                        break;
+                const char* unit;
+                if (measurement_format == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_ft);
+                    value = std::round(value * 3.28125);
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_m);
+                }
 
-                    case ControlCodes::push16:
-                        args.push<uint16_t>();
-                        break;
+                buffer = formatInt32Grouped(value, buffer);
 
-                    case ControlCodes::timeMS:
-                        throw std::runtime_error("Unimplemented format string: 15");
+                strcpy(buffer, unit);
+                buffer += strlen(unit);
 
-                    case ControlCodes::timeHM:
-                        throw std::runtime_error("Unimplemented format string: 16");
+                break;
+            }
 
-                    case ControlCodes::distance:
-                    {
-                        uint32_t value = args.pop<uint16_t>();
-                        auto measurement_format = Config::get().measurement_format;
+            case ControlCodes::height:
+            {
+                int32_t value = args.pop<int16_t>();
 
-                        const char* unit;
-                        if (measurement_format == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_ft);
-                            value = std::round(value * 3.28125);
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_m);
-                        }
+                bool showHeightAsUnits = Config::get().flags & Config::Flags::showHeightAsUnits;
+                auto measurement_format = Config::get().measurement_format;
+                const char* unit;
 
-                        buffer = formatInt32Grouped(value, buffer);
+                if (showHeightAsUnits)
+                {
+                    unit = getString(StringIds::unit_units);
+                }
+                else if (measurement_format == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_ft);
+                    value *= 16;
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_m);
+                    value *= 5;
+                }
 
-                        strcpy(buffer, unit);
-                        buffer += strlen(unit);
+                buffer = formatInt32Grouped(value, buffer);
 
-                        break;
-                    }
-
-                    case ControlCodes::height:
-                    {
-                        int32_t value = args.pop<int16_t>();
-
-                        bool showHeightAsUnits = Config::get().flags & Config::Flags::showHeightAsUnits;
-                        auto measurement_format = Config::get().measurement_format;
-                        const char* unit;
-
-                        if (showHeightAsUnits)
-                        {
-                            unit = getString(StringIds::unit_units);
-                        }
-                        else if (measurement_format == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_ft);
-                            value *= 16;
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_m);
-                            value *= 5;
-                        }
-
-                        buffer = formatInt32Grouped(value, buffer);
-
-                        strcpy(buffer, unit);
-                        buffer += strlen(unit);
+                strcpy(buffer, unit);
+                buffer += strlen(unit);
 
-                        break;
-                    }
+                break;
+            }
+
+            case ControlCodes::power:
+            {
+                uint32_t value = args.pop<int16_t>();
+                auto measurement_format = Config::get().measurement_format;
+
+                const char* unit;
+                if (measurement_format == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_hp);
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_kW);
+                    value = std::round(value * 0.746);
+                }
 
-                    case ControlCodes::power:
-                    {
-                        uint32_t value = args.pop<int16_t>();
-                        auto measurement_format = Config::get().measurement_format;
+                buffer = formatInt32Grouped(value, buffer);
 
-                        const char* unit;
-                        if (measurement_format == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_hp);
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_kW);
-                            value = std::round(value * 0.746);
-                        }
+                strcpy(buffer, unit);
+                buffer += strlen(unit);
+
+                break;
+            }
 
-                        buffer = formatInt32Grouped(value, buffer);
+            case ControlCodes::inline_sprite_args:
+            {
+                *buffer = ControlCodes::inline_sprite_str;
+                uint32_t value = args.pop<uint32_t>();
+                uint32_t* sprite_ptr = (uint32_t*)(buffer + 1);
+                *sprite_ptr = value;
+                buffer += 5;
 
-                        strcpy(buffer, unit);
-                        buffer += strlen(unit);
+                break;
+            }
+        }
 
-                        break;
-                    }
+        return buffer;
+    }
 
-                    case ControlCodes::inline_sprite_args:
-                    {
-                        *buffer = ControlCodes::inline_sprite_str;
-                        uint32_t value = args.pop<uint32_t>();
-                        uint32_t* sprite_ptr = (uint32_t*)(buffer + 1);
-                        *sprite_ptr = value;
-                        buffer += 5;
+    static char* formatStringPart(char* buffer, const char* sourceStr, ArgsWrapper& args)
+    {
+        while (true)
+        {
+            uint8_t ch = *sourceStr;
 
-                        break;
-                    }
-                }
+            if (ch == 0)
+            {
+                *buffer = '\0';
+                return buffer;
+            }
+
+            auto literalLength = getLiteralLength(ch);
+            if (literalLength != 0)
+            {
+                std::memcpy(buffer, sourceStr, literalLength);
+                buffer += literalLength;
+                sourceStr += literalLength;
+            }
+            else
+            {
+                sourceStr++;
+                auto operand = readOperand(ch, sourceStr);
+                sourceStr += getOperandLength(ch);
+                buffer = formatControlCode(buffer, ch, operand, args);
             }
         }
     }
@@ -543,6 +576,104 @@ namespace OpenLoco::StringManager
         return formatStringPart(buffer, sourceStr, wrapped);
     }
 
+    // A run of bytes copied from the source string, or an argument control code to format
+    struct CompiledOp
+    {
+        uint8_t code; // 0 for a literal run
+        uint16_t operand;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    // Language strings are compiled when loaded so that formatting them does not have to scan
+    // for control codes again. The source is kept to detect ids that have since been repointed.
+    struct CompiledString
+    {
+        const char* source = nullptr;
+        std::vector<CompiledOp> ops;
+    };
+
+    static std::vector<CompiledString> _compiledStrings;
+
+    void compileString(string_id id)
+    {
+        if (id >= USER_STRINGS_START)
+            return;
+
+        if (_compiledStrings.empty())
+        {
+            _compiledStrings.resize(USER_STRINGS_START);
+        }
+
+        auto& compiled = _compiledStrings[id];
+        compiled.source = getString(id);
+        compiled.ops.clear();
+        if (compiled.source == nullptr)
+            return;
+
+        const char* sourceStr = compiled.source;
+        const char* literalStart = sourceStr;
+        auto endLiteral = [&]() {
+            if (sourceStr != literalStart)
+            {
+                auto offset = static_cast<uint32_t>(literalStart - compiled.source);
+                auto length = static_cast<uint32_t>(sourceStr - literalStart);
+                compiled.ops.push_back({ 0, 0, offset, length });
+            }
+        };
+
+        while (*sourceStr != '\0')
+        {
+            uint8_t ch = *sourceStr;
+            auto literalLength = getLiteralLength(ch);
+            if (literalLength != 0)
+            {
+                sourceStr += literalLength;
+                continue;
+            }
+
+            endLiteral();
+            sourceStr++;
+            auto operand = readOperand(ch, sourceStr);
+            sourceStr += getOperandLength(ch);
+            compiled.ops.push_back({ ch, operand, 0, 0 });
+            literalStart = sourceStr;
+        }
+        endLiteral();
+        compiled.ops.shrink_to_fit();
+    }
+
+    void clearCompiledStrings()
+    {
+        _compiledStrings.clear();
+    }
+
+    static const CompiledString* getCompiledString(string_id id, const char* sourceStr)
+    {
+        if (id >= _compiledStrings.size() || _compiledStrings[id].source != sourceStr)
+            return nullptr;
+
+        return &_compiledStrings[id];
+    }
+
+    static char* formatCompiledString(char* buffer, const CompiledString& compiled, ArgsWrapper& args)
+    {
+        for (const auto& op : compiled.ops)
+        {
+            if (op.code == 0)
+            {
+                std::memcpy(buffer, compiled.source + op.offset, op.length);
+                buffer += op.length;
+            }
+            else
+            {
+                buffer = formatControlCode(buffer, op.code, op.operand, args);
+            }
+        }
+        *buffer = '\0';
+        return buffer;
+    }
+
     // 0x004958C6
     static char* formatString(char* buffer, string_id id, ArgsWrapper& args)
     {
@@ -557,7 +688,15 @@ namespace OpenLoco::StringManager
                 return buffer;
             }
 
-            buffer = formatStringPart(buffer, sourceStr, args);
+            auto compiled = getCompiledString(id, sourceStr);
+            if (compiled != nullptr)
+            {
+                buffer = formatCompiledString(buffer, *compiled, args);
+            }
+            else
+            {
+                buffer = formatStringPart(buffer, sourceStr, args);
+            }
             assert(*buffer == '\0');
             return buffer;
         }
@@ -124,6 +124,8 @@ namespace OpenLoco::StringManager
 {
     void reset();
     const char* getString(string_id id);
+    void compileString(string_id id);
+    void clearCompiledStrings();
     char* formatString(char* buffer, string_id id, const void* args = nullptr);
     char* formatString(char* buffer, size_t bufferLen, string_id id, const void* args = nullptr);
     string_id userStringAllocate(char* str, uint8_t cl);
@@ -8,9 +8,11 @@
 #include "Tile.h"
 #include "TileLoop.hpp"
 #include "TileManager.h"
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <random>
+#include <thread>
 #include <vector>
 
 using namespace OpenLoco::Interop;
@@ -192,6 +194,8 @@ namespace OpenLoco::Map::MapGenerator
         }
 
     private:
+        static constexpr int32_t maxWorkerThreads = 8;
+
         struct SimplexSettings
         {
             int32_t low = 2;
@@ -219,7 +223,33 @@ namespace OpenLoco::Map::MapGenerator
             auto freq = settings.baseFreq * (1.0f / std::max(heightMap.width, heightMap.height));
             uint8_t perm[512];
             noise(perm, std::size(perm));
-            for (int32_t y = 0; y < heightMap.height; y++)
+
+            // Each cell only depends on its own coordinates, so the rows can be split into
+            // bands that are generated concurrently without changing the result.
+            const auto numBands = std::clamp<int32_t>(std::thread::hardware_concurrency(), 1, maxWorkerThreads);
+            const auto bandHeight = (heightMap.height + numBands - 1) / numBands;
+
+            std::vector<std::thread> workers;
+            for (int32_t band = 1; band < numBands; band++)
+            {
+                const auto top = band * bandHeight;
+                const auto bottom = std::min(top + bandHeight, heightMap.height);
+                if (top >= bottom)
+                    break;
+
+                workers.emplace_back(generateSimplexRows, std::cref(settings), perm, freq, heightMap, top, bottom);
+            }
+            generateSimplexRows(settings, perm, freq, heightMap, 0, std::min(bandHeight, heightMap.height));
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        static void generateSimplexRows(const SimplexSettings& settings, const uint8_t* perm, float freq, HeightMapRange heightMap, int32_t top, int32_t bottom)
+        {
+            for (int32_t y = top; y < bottom; y++)
             {
                 for (int32_t x = 0; x < heightMap.width; x++)
                 {
@@ -231,30 +261,37 @@ namespace OpenLoco::Map::MapGenerator
             }
         }
 
+        // 3x3 box filter applied in place: cells above and to the left have already been
+        // smoothed in the current iteration when a cell is visited. Column sums are reused
+        // between neighbouring cells, only the column left of the cell is corrected for the
+        // value that was just written, so the result matches the full 3x3 sum exactly.
         static void smooth(int32_t iterations, HeightMapRange heightMap)
         {
             for (int32_t i = 0; i < iterations; i++)
             {
-                auto copyHeight = heightMap;
                 for (int32_t y = 1; y < heightMap.width - 1; y++)
                 {
+                    auto columnSum = [&heightMap, y](int32_t x) {
+                        return heightMap[{ x, y - 1 }] + heightMap[{ x, y }] + heightMap[{ x, y + 1 }];
+                    };
+
+                    int32_t left = columnSum(0);
+                    int32_t centre = columnSum(1);
                     for (int32_t x = 1; x < heightMap.height - 1; x++)
                     {
-                        int32_t total = 0;
-                        for (int32_t yy = -1; yy <= 1; yy++)
-                        {
-                            for (int32_t xx = -1; xx <= 1; xx++)
-                            {
-                                total += copyHeight[{ x + xx, y + yy }];
-                            }
-                        }
-                        heightMap[{ x, y }] = total / 9;
+                        const int32_t right = columnSum(x + 1);
+                        const uint8_t oldHeight = heightMap[{ x, y }];
+                        const uint8_t newHeight = (left + centre + right) / 9;
+                        heightMap[{ x, y }] = newHeight;
+
+                        left = centre - oldHeight + newHeight;
+                        centre = right;
                     }
                 }
             }
         }
 
-        static float noiseFractal(uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
+        static float noiseFractal(const uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
         {
             float total = 0.0f;
             float amplitude = persistence;
@@ -267,7 +304,7 @@ namespace OpenLoco::Map::MapGenerator
             return total;
         }
 
-        static float generateNoise(uint8_t* perm, float x, float y)
+        static float generateNoise(const uint8_t* perm, float x, float y)
         {
             const float F2 = 0.366025403f; // F2 = 0.5*(sqrt(3.0)-1.0)
             const float G2 = 0.211324865f; // G2 = (3.0-sqrt(3.0))/6.0
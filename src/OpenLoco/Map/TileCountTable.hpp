@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Map.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace OpenLoco::Map
+{
+    // Summed-area table of a per tile count (e.g. water) over a rectangular area of the map.
+    // Counting the tiles of any rectangle within the area is O(1). The table is not updated when
+    // the map changes, so only use it while the counted tiles are held still.
+    class TileCountTable
+    {
+    private:
+        TilePos2 _origin;
+        int32_t _width;
+        int32_t _height;
+        // (_width + 1) * (_height + 1) entries with a leading row and column of zeros
+        std::vector<uint32_t> _sums;
+
+        uint32_t& sumAt(int32_t x, int32_t y)
+        {
+            return _sums[y * (_width + 1) + x];
+        }
+
+        uint32_t sumAt(int32_t x, int32_t y) const
+        {
+            return _sums[y * (_width + 1) + x];
+        }
+
+    public:
+        // Covers the inclusive tile range a..b clipped to the map.
+        TileCountTable(const TilePos2& a, const TilePos2& b)
+            : _origin(std::clamp<coord_t>(std::min(a.x, b.x), 0, map_columns - 1), std::clamp<coord_t>(std::min(a.y, b.y), 0, map_rows - 1))
+            , _width(std::clamp<coord_t>(std::max(a.x, b.x), 0, map_columns - 1) - _origin.x + 1)
+            , _height(std::clamp<coord_t>(std::max(a.y, b.y), 0, map_rows - 1) - _origin.y + 1)
+            , _sums((_width + 1) * (_height + 1), 0)
+        {
+        }
+
+        template<typename TCountFunc>
+        void build(TCountFunc&& countTile)
+        {
+            for (int32_t y = 0; y < _height; y++)
+            {
+                uint32_t rowSum = 0;
+                for (int32_t x = 0; x < _width; x++)
+                {
+                    rowSum += countTile(TilePos2(_origin.x + x, _origin.y + y));
+                    sumAt(x + 1, y + 1) = sumAt(x + 1, y) + rowSum;
+                }
+            }
+        }
+
+        bool contains(const TilePos2& pos) const
+        {
+            return pos.x >= _origin.x && pos.y >= _origin.y && pos.x < _origin.x + _width && pos.y < _origin.y + _height;
+        }
+
+        // Sum of the inclusive tile range a..b. Tiles outside of the map are not counted, but
+        // any tile that is on the map must be covered by the table.
+        uint32_t count(const TilePos2& a, const TilePos2& b) const
+        {
+            const auto left = std::max<int32_t>(std::min(a.x, b.x), 0);
+            const auto top = std::max<int32_t>(std::min(a.y, b.y), 0);
+            const auto right = std::min<int32_t>(std::max(a.x, b.x), map_columns - 1);
+            const auto bottom = std::min<int32_t>(std::max(a.y, b.y), map_rows - 1);
+            if (left > right || top > bottom)
+                return 0;
+
+            assert(contains(TilePos2(left, top)) && contains(TilePos2(right, bottom)));
+            const auto x0 = left - _origin.x;
+            const auto y0 = top - _origin.y;
+            const auto x1 = right - _origin.x + 1;
+            const auto y1 = bottom - _origin.y + 1;
+            return sumAt(x1, y1) - sumAt(x0, y1) - sumAt(x1, y0) + sumAt(x0, y0);
+        }
+
+        // Sum of the square of tiles centred on centre, e.g. radius 5 gives an 11x11 area.
+        uint32_t countAround(const TilePos2& centre, int32_t radius) const
+        {
+            return count(centre - TilePos2(radius, radius), centre + TilePos2(radius, radius));
+        }
+    };
+}
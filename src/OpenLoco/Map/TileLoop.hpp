@@ -12,6 +12,7 @@ namespace OpenLoco::Map
 
     public:
         Pos2 current() const { return _pos; }
+        void setCurrent(const Pos2& pos) { _pos = pos; }
         Pos2 next()
         {
             _pos.x += tile_size;
@@ -510,6 +510,31 @@ namespace OpenLoco::Map::TileManager
         }
     }
 
+    static uint8_t countWater(const Tile& tile)
+    {
+        auto* surface = tile.surface();
+        return (surface != nullptr && surface->water() > 0) ? 1 : 0;
+    }
+
+    static uint8_t countTrees(const Tile& tile)
+    {
+        uint8_t numTrees = 0;
+        for (auto& element : tile)
+        {
+            // NB: vanilla was checking for trees above the surface element.
+            // This has been omitted from our implementation.
+            auto* tree = element.asTree();
+            if (tree == nullptr)
+                continue;
+
+            if (tree->isGhost())
+                continue;
+
+            numTrees++;
+        }
+        return numTrees;
+    }
+
     // 0x004C5596
     uint16_t countSurroundingWaterTiles(const Pos2& pos)
     {
@@ -526,10 +551,7 @@ namespace OpenLoco::Map::TileManager
                 if (!Map::validCoords(tilePos))
                     continue;
 
-                auto tile = get(tilePos);
-                auto* surface = tile.surface();
-                if (surface != nullptr && surface->water() > 0)
-                    surroundingWaterTiles++;
+                surroundingWaterTiles += countWater(get(tilePos));
             }
         }
 
@@ -552,39 +574,43 @@ namespace OpenLoco::Map::TileManager
                 if (!Map::validCoords(tilePos))
                     continue;
 
-                auto tile = get(tilePos);
-                for (auto& element : tile)
-                {
-                    // NB: vanilla was checking for trees above the surface element.
-                    // This has been omitted from our implementation.
-                    auto* tree = element.asTree();
-                    if (tree == nullptr)
-                        continue;
-
-                    if (tree->isGhost())
-                        continue;
-
-                    surroundingTrees++;
-                }
+                surroundingTrees += countTrees(get(tilePos));
             }
         }
 
         return surroundingTrees;
     }
 
+    // Table for countSurroundingWaterTiles; a..b must include the 5 tile search radius around every queried position.
+    TileCountTable buildWaterTileTable(const TilePos2& a, const TilePos2& b)
+    {
+        TileCountTable table(a, b);
+        table.build([](const TilePos2& pos) { return countWater(get(pos)); });
+        return table;
+    }
+
+    uint16_t countSurroundingWaterTiles(const TileCountTable& waterTiles, const Pos2& pos)
+    {
+        return waterTiles.countAround(TilePos2(pos), 5);
+    }
+
+    // Returns false if the update removed or added elements on the tile.
     static bool update(TileElement& el, const Map::Pos2& loc)
     {
-        registers regs;
-        regs.ax = loc.x;
-        regs.cx = loc.y;
-        regs.esi = X86Pointer(&el);
-        regs.bl = el.data()[0] & 0x3F;
+        auto callUpdate = [&el, &loc](uint32_t address) {
+            registers regs;
+            regs.ax = loc.x;
+            regs.cx = loc.y;
+            regs.esi = X86Pointer(&el);
+            regs.bl = el.data()[0] & 0x3F;
+            call(address, regs);
+            return regs.esi != 0;
+        };
 
         switch (el.type())
         {
             case ElementType::surface:
-                call(0x004691FA, regs);
-                break;
+                return callUpdate(0x004691FA);
             case ElementType::building:
             {
                 auto* elBuilding = el.asBuilding();
@@ -596,8 +622,7 @@ namespace OpenLoco::Map::TileManager
                 return elBuilding->update(loc);
             }
             case ElementType::tree:
-                call(0x004BD52B, regs);
-                break;
+                return callUpdate(0x004BD52B);
             case ElementType::road:
             {
                 auto* elRoad = el.asRoad();
@@ -605,20 +630,20 @@ namespace OpenLoco::Map::TileManager
                     return elRoad->update(loc);
                 else
                     return false;
-                break;
             }
             case ElementType::industry:
-                call(0x00456FF7, regs);
-                break;
+                return callUpdate(0x00456FF7);
+            // No periodic update
             case ElementType::track: break;
             case ElementType::station: break;
             case ElementType::signal: break;
             case ElementType::wall: break;
         }
-        return regs.esi != 0;
+        return true;
     }
 
     // 0x00463ABA
+    // Every surface is updated for snow and growth, so each tile of the slice has to be visited.
     void update()
     {
         if ((addr<0x00525E28, uint32_t>() & 1) == 0)
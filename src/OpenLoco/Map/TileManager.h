@@ -2,6 +2,7 @@
 
 #include "../Core/Span.hpp"
 #include "Tile.h"
+#include "TileCountTable.hpp"
 #include <cstdint>
 #include <tuple>
 
@@ -33,6 +34,8 @@ namespace OpenLoco::Map::TileManager
     void resetSurfaceClearance();
     uint16_t countSurroundingWaterTiles(const Pos2& pos);
     uint16_t countSurroundingTrees(const Pos2& pos);
+    TileCountTable buildWaterTileTable(const TilePos2& a, const TilePos2& b);
+    uint16_t countSurroundingWaterTiles(const TileCountTable& waterTiles, const Pos2& pos);
     void update();
     void registerHooks();
 }
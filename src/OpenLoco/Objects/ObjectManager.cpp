@@ -1,4 +1,5 @@
 #include "ObjectManager.h"
+#include "../Audio/Audio.h"
 #include "../Core/FileSystem.hpp"
 #include "../Graphics/Colour.h"
 #include "../Graphics/Gfx.h"
@@ -480,6 +481,7 @@ namespace OpenLoco::ObjectManager
     void reloadAll()
     {
         call(0x0047237D);
+        Audio::preloadObjectSamples();
     }
 
     enum class ObjectProcedure
@@ -5,7 +5,6 @@
 #include <iostream>
 #include <setjmp.h>
 #include <string>
-#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -31,7 +30,9 @@
 #include "Entities/EntityManager.h"
 #include "Entities/EntityTweener.h"
 #include "Environment.h"
+#include "FramePacer.h"
 #include "Game.h"
+#include "GameCommands/Journal.h"
 #include "GameException.hpp"
 #include "Graphics/Colour.h"
 #include "Graphics/Gfx.h"
@@ -39,6 +40,7 @@
 #include "IndustryManager.h"
 #include "Input.h"
 #include "Interop/Interop.hpp"
+#include "Interop/MemoryTracker.h"
 #include "Intro.h"
 #include "Localisation/LanguageFiles.h"
 #include "Localisation/Languages.h"
@@ -109,10 +111,13 @@ namespace OpenLoco
     static loco_global<char[256], 0x011368A0> _11368A0;
 
     static int32_t _monthsSinceLastAutosave;
+    static bool _isTickingUncapped = false;
 
     static void autosaveReset();
     static void tickLogic(int32_t count);
+    static void tickLogicUncapped();
     static void tickLogic();
+    static void replayJournal();
     static void dateTick();
     static void sub_46FFCA();
 
@@ -242,7 +247,7 @@ namespace OpenLoco
 
     void setGameSpeed(uint8_t speed)
     {
-        assert(speed >= 0 && speed <= 3);
+        assert(speed >= GameSpeed::normal && speed <= GameSpeed::uncapped);
         _gameSpeed = speed;
     }
 
@@ -354,6 +359,7 @@ namespace OpenLoco
         Ui::disposeCursors();
         Ui::disposeInput();
         Localisation::unloadLanguageFile();
+        Interop::MemoryTracker::dumpStats();
 
         auto tempFilePath = Environment::getPathNoWarning(Environment::path_id::_1tmp);
         if (fs::exists(tempFilePath))
@@ -566,6 +572,7 @@ namespace OpenLoco
     static void tickInterrupted()
     {
         EntityTweener::get().reset();
+        _isTickingUncapped = false;
         Console::log("Tick interrupted");
     }
 
@@ -744,7 +751,19 @@ namespace OpenLoco
                     }
 
                     sub_46FFCA();
-                    tickLogic(numUpdates);
+                    GameCommands::Journal::update();
+                    if (GameCommands::Journal::isReplaying())
+                    {
+                        replayJournal();
+                    }
+                    else if (_gameSpeed == GameSpeed::uncapped && numUpdates != 0 && !isNetworked())
+                    {
+                        tickLogicUncapped();
+                    }
+                    else
+                    {
+                        tickLogic(numUpdates);
+                    }
 
                     _525F62++;
                     if (isEditorMode())
@@ -806,6 +825,32 @@ namespace OpenLoco
         }
     }
 
+    // Runs logic ticks until the frame time is used up, so the simulation is limited by how fast
+    // it can run rather than by the frame rate. Stops early if the game is paused or slowed down.
+    static void tickLogicUncapped()
+    {
+        const auto startTime = platform::getTime();
+        _isTickingUncapped = true;
+        do
+        {
+            tickLogic();
+        } while (_gameSpeed == GameSpeed::uncapped && !isPaused() && platform::getTime() - startTime < Engine::UncappedFrameTimeMs);
+        _isTickingUncapped = false;
+
+        // Sounds are only updated once per frame
+        Audio::updateVehicleNoise();
+        Audio::updateAmbientNoise();
+    }
+
+    // Runs the tick logic without rendering until the journal being replayed is exhausted or diverges.
+    static void replayJournal()
+    {
+        while (GameCommands::Journal::isReplaying())
+        {
+            tickLogic();
+        }
+    }
+
     static void sub_46FFCA()
     {
         addr<0x010E7D3C, uint32_t>() = 0x2A0015;
@@ -827,6 +872,7 @@ namespace OpenLoco
     // 0x0046ABCB
     static void tickLogic()
     {
+        GameCommands::Journal::preTick();
         _scenario_ticks++;
         addr<0x00525F64, int32_t>()++;
         addr<0x00525FCC, uint32_t>() = _prng->srand_0();
@@ -845,8 +891,11 @@ namespace OpenLoco
         sub_46FFCA();
         CompanyManager::update();
         AnimationManager::update();
-        Audio::updateVehicleNoise();
-        Audio::updateAmbientNoise();
+        if (!_isTickingUncapped)
+        {
+            Audio::updateVehicleNoise();
+            Audio::updateAmbientNoise();
+        }
         Title::update();
 
         S5::getOptions().madeAnyChanges = addr<0x00F25374, uint8_t>();
@@ -862,6 +911,7 @@ namespace OpenLoco
             _50C197 = 0;
             Ui::Windows::showError(title, message);
         }
+        GameCommands::Journal::postTick();
     }
 
     static void autosaveReset()
@@ -990,6 +1040,7 @@ namespace OpenLoco
                     addr<0x00526243, uint16_t>()++;
                     TownManager::updateMonthly();
                     IndustryManager::updateMonthly();
+                    Interop::MemoryTracker::dumpStats();
                     call(0x0043037B);
                     call(0x0042F213);
                     call(0x004C3C54);
@@ -1026,19 +1077,11 @@ namespace OpenLoco
         }
     }
 
-    static void tickWait()
-    {
-        // Idle loop for a 40 FPS
-        do
-        {
-            std::this_thread::yield();
-        } while (platform::getTime() - last_tick_time < 25);
-    }
-
     void promptTickLoop(std::function<bool()> tickAction)
     {
         while (true)
         {
+            const auto frameStart = FramePacer::Clock::now();
             last_tick_time = platform::getTime();
             time_since_last_tick = 31;
             if (!Ui::processMessages() || !tickAction())
@@ -1046,7 +1089,10 @@ namespace OpenLoco
                 break;
             }
             Ui::render();
-            tickWait();
+            FramePacer::frameRendered();
+
+            // Idle for a 40 FPS
+            FramePacer::waitUntil(frameStart + std::chrono::milliseconds(Engine::UpdateRateInMs));
         }
     }
 
@@ -1056,6 +1102,7 @@ namespace OpenLoco
 
     static void variableUpdate()
     {
+        const auto frameStart = FramePacer::Clock::now();
         auto& tweener = EntityTweener::get();
 
         const auto alpha = std::min<float>(_accumulator / UpdateTime, 1.0);
@@ -1073,6 +1120,14 @@ namespace OpenLoco
         tweener.tween(alpha);
 
         Ui::render();
+        FramePacer::frameRendered();
+
+        // Rendering faster than the display refreshes would only produce frames that are never shown
+        const auto refreshInterval = FramePacer::getRefreshInterval(Ui::getDisplayRefreshRate());
+        if (refreshInterval != FramePacer::Clock::duration::zero())
+        {
+            FramePacer::waitUntil(frameStart + refreshInterval);
+        }
     }
 
     static void fixedUpdate()
@@ -1082,14 +1137,15 @@ namespace OpenLoco
 
         if (_accumulator < UpdateTime)
         {
-            auto timeMissing = static_cast<uint32_t>((UpdateTime - _accumulator) * 1000);
-            std::this_thread::sleep_for(std::chrono::milliseconds(timeMissing));
+            const auto timeMissing = std::chrono::duration<double>(UpdateTime - _accumulator);
+            FramePacer::waitFor(std::chrono::duration_cast<FramePacer::Clock::duration>(timeMissing));
         }
 
         tick();
         _accumulator -= UpdateTime;
 
         Ui::render();
+        FramePacer::frameRendered();
     }
 
     static void update()
@@ -1168,6 +1224,7 @@ namespace OpenLoco
         {
             const auto& cfg = Config::readNewConfig();
             Environment::resolvePaths();
+            GameCommands::Journal::initialise();
 
             registerHooks();
             if (sub_4054B9())
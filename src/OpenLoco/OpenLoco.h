@@ -15,6 +15,17 @@ namespace OpenLoco
         constexpr uint32_t UpdateRateHz = 40;
         constexpr uint32_t UpdateRateInMs = 1000 / UpdateRateHz;
         constexpr uint32_t MaxUpdates = 3;
+        // Time spent on logic ticks between frames when the game speed is uncapped
+        constexpr uint32_t UncappedFrameTimeMs = 100;
+    }
+
+    namespace GameSpeed
+    {
+        constexpr uint8_t normal = 0;
+        constexpr uint8_t fastForward = 1;
+        constexpr uint8_t extraFastForward = 2;
+        // As many logic ticks as fit in a frame, new in OpenLoco
+        constexpr uint8_t uncapped = 3;
     }
 
     namespace ScreenFlags
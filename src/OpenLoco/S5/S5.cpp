@@ -610,6 +610,8 @@ namespace OpenLoco::S5
             TileManager::setElements(stdx::span<Map::TileElement>(reinterpret_cast<Map::TileElement*>(file->tileElements.data()), file->tileElements.size()));
 
             EntityManager::resetSpatialIndex();
+            Audio::resetVehicleNoise();
+            IndustryManager::invalidateOwnedTiles();
             CompanyManager::updateColours();
             call(0x004748FA);
             TileManager::resetSurfaceClearance();
@@ -5,6 +5,7 @@
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -20,6 +21,36 @@ using namespace OpenLoco::Utility;
 constexpr const char* exceptionInvalidRLE = "Invalid RLE run";
 constexpr const char* exceptionUnknownEncoding = "Unknown encoding";
 
+// Sums bytes eight at a time, adding the four 16-bit lanes of each even and odd byte half. The
+// lanes are folded into the total before they can overflow.
+static uint32_t sumBytes(const uint8_t* data, size_t len)
+{
+    constexpr uint64_t laneMask = 0x00FF00FF00FF00FFull;
+    constexpr size_t maxIterations = 128; // 128 * 2 * 255 fits in a 16-bit lane
+
+    uint32_t sum = 0;
+    size_t i = 0;
+    while (len - i >= 8)
+    {
+        uint64_t lanes = 0;
+        auto iterations = std::min((len - i) / 8, maxIterations);
+        for (size_t j = 0; j < iterations; j++, i += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            lanes += word & laneMask;
+            lanes += (word >> 8) & laneMask;
+        }
+        lanes = (lanes & 0x0000FFFF0000FFFFull) + ((lanes >> 16) & 0x0000FFFF0000FFFFull);
+        sum += static_cast<uint32_t>(lanes) + static_cast<uint32_t>(lanes >> 32);
+    }
+    for (; i < len; i++)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
 uint8_t* FastBuffer::alloc(size_t len)
 {
 #ifdef _WIN32
@@ -178,10 +209,7 @@ bool SawyerStreamReader::validateChecksum()
         {
             auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
             _stream.read(reinterpret_cast<char*>(buffer), readLength);
-            for (size_t j = 0; j < readLength; j++)
-            {
-                actualChecksum += buffer[j];
-            }
+            actualChecksum += sumBytes(buffer, readLength);
         }
 
         valid = checksum == actualChecksum;
@@ -307,61 +335,116 @@ SawyerStreamWriter::SawyerStreamWriter(const fs::path& path)
 {
     _stream.exceptions(std::ifstream::failbit);
     _stream.open(path, std::ios::out | std::ios::binary);
+
+    // Chunks waiting to be written hold their encoded data, so bound how many are in flight
+    _maxPending = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 4);
 }
 
 void SawyerStreamWriter::writeChunk(SawyerEncoding chunkType, const void* data, size_t dataLen)
 {
-    auto encodedData = encode(chunkType, stdx::span(reinterpret_cast<const uint8_t*>(data), dataLen));
-    write(&chunkType, sizeof(chunkType));
-    write(static_cast<uint32_t>(encodedData.size()));
-    write(encodedData.data(), encodedData.size());
+    auto pending = std::make_unique<PendingWrite>();
+    pending->encoding = chunkType;
+    pending->isChunk = true;
+    pending->source = stdx::span(reinterpret_cast<const uint8_t*>(data), dataLen);
+
+    auto* p = pending.get();
+    p->done = std::async(std::launch::async, [p] {
+        p->encoded = encode(p->encoding, p->source, p->buffer, p->scratch);
+    });
+    _pending.push_back(std::move(pending));
+
+    while (_pending.size() > _maxPending)
+    {
+        writePending();
+    }
 }
 
 void SawyerStreamWriter::write(const void* data, size_t dataLen)
+{
+    if (_pending.empty())
+    {
+        writeToStream(data, dataLen);
+        return;
+    }
+
+    // Keep the order of the file, the caller's data may not outlive this call
+    auto pending = std::make_unique<PendingWrite>();
+    pending->buffer.push_back(reinterpret_cast<const uint8_t*>(data), dataLen);
+    pending->encoded = pending->buffer.getSpan();
+    _pending.push_back(std::move(pending));
+}
+
+// Writes the oldest pending chunk, waiting for its encoding if need be.
+void SawyerStreamWriter::writePending()
+{
+    auto& pending = *_pending.front();
+    if (pending.done.valid())
+    {
+        // Rethrows any exception from the encoding
+        pending.done.get();
+    }
+
+    if (pending.isChunk)
+    {
+        writeToStream(&pending.encoding, sizeof(pending.encoding));
+        auto encodedLength = static_cast<uint32_t>(pending.encoded.size());
+        writeToStream(&encodedLength, sizeof(encodedLength));
+    }
+    writeToStream(pending.encoded.data(), pending.encoded.size());
+    _pending.pop_front();
+}
+
+void SawyerStreamWriter::writeToStream(const void* data, size_t dataLen)
 {
     _stream.write(reinterpret_cast<const char*>(data), dataLen);
-    auto data8 = reinterpret_cast<const uint8_t*>(data);
-    for (size_t i = 0; i < dataLen; i++)
+    _checksum += sumBytes(reinterpret_cast<const uint8_t*>(data), dataLen);
+}
+
+void SawyerStreamWriter::flush()
+{
+    while (!_pending.empty())
     {
-        _checksum += data8[i];
+        writePending();
     }
 }
 
 void SawyerStreamWriter::writeChecksum()
 {
+    flush();
     _stream.write(reinterpret_cast<const char*>(&_checksum), sizeof(_checksum));
 }
 
 void SawyerStreamWriter::close()
 {
+    flush();
     _stream.close();
 }
 
-stdx::span<uint8_t const> SawyerStreamWriter::encode(SawyerEncoding encoding, stdx::span<uint8_t const> data)
+stdx::span<uint8_t const> SawyerStreamWriter::encode(SawyerEncoding encoding, stdx::span<uint8_t const> data, FastBuffer& buffer, FastBuffer& scratch)
 {
     switch (encoding)
     {
         case SawyerEncoding::uncompressed:
             return data;
         case SawyerEncoding::runLengthSingle:
-            _encodeBuffer.clear();
-            _encodeBuffer.reserve(data.size());
-            encodeRunLengthSingle(_encodeBuffer, data);
-            return _encodeBuffer.getSpan();
+            buffer.clear();
+            buffer.reserve(data.size());
+            encodeRunLengthSingle(buffer, data);
+            return buffer.getSpan();
         case SawyerEncoding::runLengthMulti:
-            _encodeBuffer.clear();
-            _encodeBuffer.reserve(data.size());
-            encodeRunLengthMulti(_encodeBuffer, data);
-
-            _encodeBuffer2.clear();
-            _encodeBuffer2.reserve(_encodeBuffer.size());
-            encodeRunLengthSingle(_encodeBuffer2, _encodeBuffer.getSpan());
-            return _encodeBuffer2.getSpan();
+            scratch.clear();
+            scratch.reserve(data.size());
+            encodeRunLengthMulti(scratch, data);
+
+            buffer.clear();
+            buffer.reserve(scratch.size());
+            encodeRunLengthSingle(buffer, scratch.getSpan());
+            return buffer.getSpan();
         case SawyerEncoding::rotate:
-            _encodeBuffer.clear();
-            _encodeBuffer.reserve(data.size());
-            encodeRotate(_encodeBuffer, data);
-            return _encodeBuffer.getSpan();
+            buffer.clear();
+            buffer.reserve(data.size());
+            encodeRotate(buffer, data);
+            return buffer.getSpan();
         default:
             throw std::runtime_error(exceptionUnknownEncoding);
     }
@@ -3,7 +3,10 @@
 #include "../Core/FileSystem.hpp"
 #include "../Core/Span.hpp"
 #include <cstdint>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <memory>
 
 namespace OpenLoco
 {
@@ -73,21 +76,41 @@ namespace OpenLoco
     class SawyerStreamWriter
     {
     private:
+        // A chunk or plain data waiting to be written in order. Chunks are encoded on a worker thread.
+        struct PendingWrite
+        {
+            SawyerEncoding encoding{};
+            bool isChunk{};
+            stdx::span<uint8_t const> source;
+            FastBuffer buffer;
+            FastBuffer scratch;
+            stdx::span<uint8_t const> encoded;
+            // Last so that it waits for the encoding to finish before the buffers are freed
+            std::future<void> done;
+        };
+
         std::ofstream _stream;
         uint32_t _checksum{};
-        FastBuffer _encodeBuffer;
-        FastBuffer _encodeBuffer2;
+        std::deque<std::unique_ptr<PendingWrite>> _pending;
+        size_t _maxPending{};
 
-        stdx::span<uint8_t const> encode(SawyerEncoding encoding, stdx::span<uint8_t const> data);
+        static stdx::span<uint8_t const> encode(SawyerEncoding encoding, stdx::span<uint8_t const> data, FastBuffer& buffer, FastBuffer& scratch);
         static void encodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void encodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data);
 
+        void writeToStream(const void* data, size_t dataLen);
+        void writePending();
+
     public:
         SawyerStreamWriter(const fs::path& path);
 
+        // Chunk data is not copied, it is encoded in the background straight from the caller's
+        // memory. It must stay alive and unmodified until flush() returns; writeChecksum() and
+        // close() flush as well. write() copies its data and has no such requirement.
         void writeChunk(SawyerEncoding chunkType, const void* data, size_t dataLen);
         void write(const void* data, size_t dataLen);
+        void flush();
         void writeChecksum();
         void close();
 
@@ -1,4 +1,5 @@
 #include "Scenario.h"
+#include "Audio/Audio.h"
 #include "CompanyManager.h"
 #include "Date.h"
 #include "Economy/Economy.h"
@@ -184,6 +185,7 @@ namespace OpenLoco::Scenario
         TownManager::reset();
         IndustryManager::reset();
         StationManager::reset();
+        Audio::resetVehicleNoise();
 
         sub_4A8810();
         sub_4702EC();
@@ -5,32 +5,24 @@ using namespace OpenLoco::Interop;
 
 namespace OpenLoco::Map::TrackData
 {
-    static loco_global<const MoveInfo* [352], 0x04D9724> _4D9724; // 44 trackId's * 8 directions
-    static loco_global<const MoveInfo* [80], 0x04D9CA4> _4D9CA4;  // 10 roadId's * 8 directions
+    static loco_global<const MoveInfo* [numTrackAndDirections], 0x04D9724> _4D9724;
+    static loco_global<const MoveInfo* [numRoadAndDirections], 0x04D9CA4> _4D9CA4;
 
-    const std::vector<MoveInfo> getTrackSubPositon(uint16_t trackAndDirection)
+    // The number of entries is stored in the word preceding each array
+    static stdx::span<const MoveInfo> getSubPositions(const MoveInfo* moveInfoStart)
     {
-        auto* moveInfoStart = _4D9724[trackAndDirection];
         auto moveInfoSize = *(reinterpret_cast<const uint16_t*>(moveInfoStart) - 1);
-        std::vector<MoveInfo> moveInfoArr;
-        moveInfoArr.resize(moveInfoSize);
-        for (auto i = 0; i < moveInfoSize; ++i)
-        {
-            moveInfoArr[i] = moveInfoStart[i];
-        }
-        return moveInfoArr;
+        return stdx::span<const MoveInfo>(moveInfoStart, moveInfoSize);
     }
 
-    const std::vector<MoveInfo> getRoadSubPositon(uint16_t trackAndDirection)
+    // The original data is never modified, so it is referenced rather than copied
+    stdx::span<const MoveInfo> getTrackSubPositon(uint16_t trackAndDirection)
     {
-        auto* moveInfoStart = _4D9CA4[trackAndDirection];
-        auto moveInfoSize = *(reinterpret_cast<const uint16_t*>(moveInfoStart) - 1);
-        std::vector<MoveInfo> moveInfoArr;
-        moveInfoArr.resize(moveInfoSize);
-        for (auto i = 0; i < moveInfoSize; ++i)
-        {
-            moveInfoArr[i] = moveInfoStart[i];
-        }
-        return moveInfoArr;
+        return getSubPositions(_4D9724[trackAndDirection]);
+    }
+
+    stdx::span<const MoveInfo> getRoadSubPositon(uint16_t trackAndDirection)
+    {
+        return getSubPositions(_4D9CA4[trackAndDirection]);
     }
 }
@@ -1,8 +1,8 @@
 #pragma once
 
+#include "Core/Span.hpp"
 #include "Map/Map.hpp"
 #include "Types.hpp"
-#include <vector>
 
 namespace OpenLoco::Map::TrackData
 {
@@ -16,6 +16,9 @@ namespace OpenLoco::Map::TrackData
 #pragma pack(pop)
     static_assert(sizeof(MoveInfo) == 0x8);
 
-    const std::vector<MoveInfo> getTrackSubPositon(uint16_t trackAndDirection);
-    const std::vector<MoveInfo> getRoadSubPositon(uint16_t trackAndDirection);
+    constexpr uint16_t numTrackAndDirections = 352; // 44 trackId's * 8 directions
+    constexpr uint16_t numRoadAndDirections = 80;   // 10 roadId's * 8 directions
+
+    stdx::span<const MoveInfo> getTrackSubPositon(uint16_t trackAndDirection);
+    stdx::span<const MoveInfo> getRoadSubPositon(uint16_t trackAndDirection);
 }
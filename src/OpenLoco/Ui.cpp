@@ -861,6 +861,19 @@ namespace OpenLoco::Ui
         return { Ui::width(), Ui::height() };
     }
 
+    // Refresh rate in Hz of the display the window is on, or 0 if unknown.
+    int32_t getDisplayRefreshRate()
+    {
+        if (window == nullptr)
+            return 0;
+
+        SDL_DisplayMode mode;
+        if (SDL_GetWindowDisplayMode(window, &mode) != 0)
+            return 0;
+
+        return mode.refresh_rate;
+    }
+
     Config::Resolution getDesktopResolution()
     {
         int32_t displayIndex = SDL_GetWindowDisplayIndex(window);
@@ -132,6 +132,7 @@ namespace OpenLoco::Ui
     void showMessageBox(const std::string& title, const std::string& message);
     Config::Resolution getResolution();
     Config::Resolution getDesktopResolution();
+    int32_t getDisplayRefreshRate();
     bool setDisplayMode(Config::ScreenMode mode, Config::Resolution newResolution);
     bool setDisplayMode(Config::ScreenMode mode);
     void updateFullscreenResolutions();
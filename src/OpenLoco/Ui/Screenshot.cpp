@@ -1,14 +1,27 @@
 #include "Screenshot.h"
+#include "../Console.h"
 #include "../Graphics/Gfx.h"
 #include "../Interop/Interop.hpp"
 #include "../Localisation/StringIds.h"
+#include "../Map/Tile.h"
 #include "../Platform/Platform.h"
 #include "../S5/S5.h"
 #include "../Ui.h"
+#include "../Ui/WindowManager.h"
+#include "../Viewport.hpp"
+#include "../Window.h"
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <png.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 #pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non-portable
 
@@ -17,6 +30,12 @@ using namespace OpenLoco::Ui;
 
 namespace OpenLoco::Input
 {
+    static loco_global<uint8_t[256][4], 0x0113ED20> _113ED20;
+
+    constexpr size_t numPaletteEntries = 246;
+
+    using Palette = std::array<png_color, numPaletteEntries>;
+
     static void pngWriteData(png_structp png_ptr, png_bytep data, png_size_t length)
     {
         auto ostream = static_cast<std::ostream*>(png_get_io_ptr(png_ptr));
@@ -29,8 +48,20 @@ namespace OpenLoco::Input
         ostream->flush();
     }
 
-    // 0x00452667
-    std::string saveScreenshot()
+    static Palette getPalette()
+    {
+        Palette palette;
+        for (size_t i = 0; i < numPaletteEntries; i++)
+        {
+            palette[i].blue = _113ED20[i][0];
+            palette[i].green = _113ED20[i][1];
+            palette[i].red = _113ED20[i][2];
+        }
+        return palette;
+    }
+
+    // Finds a free file name based on the scenario name in the user directory.
+    static fs::path getScreenshotPath(std::string& fileName)
     {
         auto basePath = platform::getUserDirectory();
         std::string scenarioName = S5::getOptions().scenarioName;
@@ -38,29 +69,24 @@ namespace OpenLoco::Input
         if (scenarioName.length() == 0)
             scenarioName = StringManager::getString(StringIds::screenshot_filename_template);
 
-        std::string fileName = std::string(scenarioName) + ".png";
-        fs::path path;
-        int16_t suffix;
-        for (suffix = 1; suffix <= std::numeric_limits<int16_t>().max(); suffix++)
+        fileName = std::string(scenarioName) + ".png";
+        for (int16_t suffix = 1; suffix <= std::numeric_limits<int16_t>().max(); suffix++)
         {
             if (!fs::exists(basePath / fileName))
             {
-                path = basePath / fileName;
-                break;
+                return basePath / fileName;
             }
 
             fileName = std::string(scenarioName) + " (" + std::to_string(suffix) + ").png";
         }
 
-        if (path.empty())
-        {
-            throw std::runtime_error("Failed finding filename");
-        }
-
-        std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
-
-        static loco_global<uint8_t[256][4], 0x0113ED20> _113ED20;
+        throw std::runtime_error("Failed finding filename");
+    }
 
+    // Writes an indexed png row by row. Any libpng error is reported as an exception.
+    template<typename TGetRow>
+    static void writePng(std::ostream& outputStream, const Palette& sourcePalette, uint32_t width, uint32_t height, TGetRow&& getRow)
+    {
         png_structp png_ptr = nullptr;
         png_colorp palette = nullptr;
         try
@@ -81,29 +107,21 @@ namespace OpenLoco::Input
             if (info_ptr == nullptr)
                 throw std::runtime_error("png_create_info_struct failed.");
 
-            palette = (png_colorp)png_malloc(png_ptr, 246 * sizeof(png_color));
+            palette = (png_colorp)png_malloc(png_ptr, numPaletteEntries * sizeof(png_color));
             if (palette == nullptr)
                 throw std::runtime_error("png_malloc failed.");
 
-            for (size_t i = 0; i < 246; i++)
-            {
-                palette[i].blue = _113ED20[i][0];
-                palette[i].green = _113ED20[i][1];
-                palette[i].red = _113ED20[i][2];
-            }
-            png_set_PLTE(png_ptr, info_ptr, palette, 246);
-            auto& context = Gfx::screenContext();
+            std::copy(sourcePalette.begin(), sourcePalette.end(), palette);
+            png_set_PLTE(png_ptr, info_ptr, palette, numPaletteEntries);
 
             png_byte transparentIndex = 0;
             png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
-            png_set_IHDR(png_ptr, info_ptr, context.width, context.height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+            png_set_IHDR(png_ptr, info_ptr, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
             png_write_info(png_ptr, info_ptr);
 
-            uint8_t* data = context.bits;
-            for (int y = 0; y < context.height; y++)
+            for (uint32_t y = 0; y < height; y++)
             {
-                png_write_row(png_ptr, data);
-                data += context.pitch + context.width;
+                png_write_row(png_ptr, getRow(y));
             }
 
             png_write_end(png_ptr, nullptr);
@@ -117,7 +135,240 @@ namespace OpenLoco::Input
             png_destroy_write_struct(&png_ptr, nullptr);
             throw;
         }
+    }
+
+    // 0x00452667
+    std::string saveScreenshot()
+    {
+        std::string fileName;
+        auto path = getScreenshotPath(fileName);
+        std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
+
+        auto& context = Gfx::screenContext();
+        const uint8_t* data = context.bits;
+        writePng(outputStream, getPalette(), context.width, context.height, [&](uint32_t) {
+            auto row = data;
+            data += context.pitch + context.width;
+            return row;
+        });
 
         return fileName;
     }
+
+    // Rows painted per strip of a giant screenshot
+    constexpr int16_t giantStripHeight = 64;
+    // Painted strips waiting for the writer, bounds the memory used
+    constexpr size_t giantMaxQueuedStrips = 4;
+    // Maximum height of anything on the map, so mountains at the top edge are not cut off
+    constexpr coord_t giantMaxHeight = 255 * 4;
+
+    // The map is painted one horizontal strip per update on the main thread, as painting uses
+    // the game state. The strips are compressed and written on a worker thread.
+    class GiantScreenshot
+    {
+    private:
+        std::string _fileName;
+        std::ofstream _outputStream;
+        Viewport _viewport{};
+        int32_t _rotation;
+        int16_t _width;
+        int16_t _height;
+        int16_t _nextRow = 0;
+        std::chrono::steady_clock::time_point _startTime;
+
+        std::thread _writer;
+        std::mutex _mutex;
+        std::condition_variable _stripQueued;
+        std::deque<std::vector<uint8_t>> _strips;
+        bool _isWriting = true;
+        std::exception_ptr _error;
+
+        void write(Palette palette)
+        {
+            try
+            {
+                std::vector<uint8_t> strip;
+                size_t stripRow = giantStripHeight;
+                writePng(_outputStream, palette, _width, _height, [&](uint32_t) {
+                    if (stripRow == giantStripHeight)
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _stripQueued.wait(lock, [this] { return !_strips.empty(); });
+                        strip = std::move(_strips.front());
+                        _strips.pop_front();
+                        stripRow = 0;
+                    }
+                    return strip.data() + _width * stripRow++;
+                });
+                _outputStream.close();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isWriting = false;
+        }
+
+    public:
+        GiantScreenshot(uint8_t zoom, int32_t rotation, uint16_t viewportFlags)
+            : _rotation(rotation)
+        {
+            auto path = getScreenshotPath(_fileName);
+            _outputStream.open(path, std::ios::out | std::ios::binary);
+            if (!_outputStream.is_open())
+            {
+                throw std::runtime_error("Unable to open screenshot file");
+            }
+
+            // Bounds of the whole map in viewport coordinates
+            int32_t left = std::numeric_limits<int32_t>::max();
+            int32_t right = std::numeric_limits<int32_t>::min();
+            int32_t top = std::numeric_limits<int32_t>::max();
+            int32_t bottom = std::numeric_limits<int32_t>::min();
+            for (auto x : { coord_t(0), Map::map_width })
+            {
+                for (auto y : { coord_t(0), Map::map_height })
+                {
+                    auto vpos = Map::gameToScreen(Map::Pos3(x, y, 0), rotation);
+                    left = std::min<int32_t>(left, vpos.x);
+                    right = std::max<int32_t>(right, vpos.x);
+                    top = std::min<int32_t>(top, vpos.y);
+                    bottom = std::max<int32_t>(bottom, vpos.y);
+                }
+            }
+            top -= giantMaxHeight;
+
+            _width = static_cast<int16_t>((right - left) >> zoom);
+            _height = static_cast<int16_t>((bottom - top) >> zoom);
+            _viewport.x = 0;
+            _viewport.y = 0;
+            _viewport.width = _width;
+            _viewport.height = giantStripHeight;
+            _viewport.view_x = left;
+            _viewport.view_y = top;
+            _viewport.view_width = _width << zoom;
+            _viewport.view_height = giantStripHeight << zoom;
+            _viewport.zoom = zoom;
+            _viewport.flags = viewportFlags;
+
+            _startTime = std::chrono::steady_clock::now();
+            _writer = std::thread(&GiantScreenshot::write, this, getPalette());
+        }
+
+        ~GiantScreenshot()
+        {
+            if (_writer.joinable())
+            {
+                {
+                    // Let the writer finish with blank rows
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    for (auto row = _nextRow; row < _height; row += giantStripHeight)
+                    {
+                        _strips.emplace_back(static_cast<size_t>(_width) * giantStripHeight, 0);
+                    }
+                    _nextRow = _height;
+                }
+                _stripQueued.notify_one();
+                _writer.join();
+            }
+        }
+
+        const std::string& getFileName() const
+        {
+            return _fileName;
+        }
+
+        // Paints the next strip unless the writer is behind. Returns true once the file is written.
+        bool update()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_error)
+                {
+                    _writer.join();
+                    std::rethrow_exception(_error);
+                }
+                if (!_isWriting)
+                {
+                    _writer.join();
+                    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _startTime).count();
+                    Console::log("Giant screenshot of %dx%d written in %d ms", _width, _height, static_cast<int32_t>(elapsed));
+                    return true;
+                }
+                if (_nextRow >= _height || _strips.size() >= giantMaxQueuedStrips)
+                {
+                    return false;
+                }
+            }
+
+            std::vector<uint8_t> strip(static_cast<size_t>(_width) * giantStripHeight, 0);
+            Gfx::Context context{};
+            context.bits = strip.data();
+            context.width = _width;
+            context.height = giantStripHeight;
+
+            // Painting uses the global rotation
+            const auto previousRotation = _viewport.getRotation();
+            _viewport.setRotation(_rotation);
+            _viewport.render(&context);
+            _viewport.setRotation(previousRotation);
+
+            _viewport.view_y += _viewport.view_height;
+            _nextRow += giantStripHeight;
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _strips.push_back(std::move(strip));
+            }
+            _stripQueued.notify_one();
+            return false;
+        }
+    };
+
+    static std::unique_ptr<GiantScreenshot> _giantScreenshot;
+
+    // Starts rendering the whole map as seen by the main viewport.
+    void startGiantScreenshot()
+    {
+        if (_giantScreenshot != nullptr)
+            return;
+
+        auto main = WindowManager::getMainWindow();
+        if (main == nullptr || main->viewports[0] == nullptr)
+        {
+            throw std::runtime_error("No main viewport");
+        }
+
+        auto viewport = main->viewports[0];
+        _giantScreenshot = std::make_unique<GiantScreenshot>(viewport->zoom, viewport->getRotation(), viewport->flags);
+    }
+
+    std::optional<std::string> updateGiantScreenshot()
+    {
+        if (_giantScreenshot == nullptr)
+            return std::nullopt;
+
+        try
+        {
+            if (!_giantScreenshot->update())
+                return std::nullopt;
+        }
+        catch (const std::exception&)
+        {
+            _giantScreenshot = nullptr;
+            throw;
+        }
+
+        auto fileName = _giantScreenshot->getFileName();
+        _giantScreenshot = nullptr;
+        return fileName;
+    }
+
+    bool isGiantScreenshotInProgress()
+    {
+        return _giantScreenshot != nullptr;
+    }
 }
@@ -1,7 +1,15 @@
+#pragma once
+
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace OpenLoco::Input
 {
     std::string saveScreenshot();
+
+    void startGiantScreenshot();
+    // Renders the next part of a giant screenshot in progress, returns the file name once it is saved.
+    std::optional<std::string> updateGiantScreenshot();
+    bool isGiantScreenshotInProgress();
 }
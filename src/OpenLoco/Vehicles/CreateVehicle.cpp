@@ -340,8 +340,9 @@ namespace OpenLoco::Vehicles
             return false;
         }
 
-        // Get Car insertion location
+        // Get Car insertion location, the tail is found before the new car breaks up the consist
         Vehicle train(head);
+        auto* const tail = train.getTail();
         // lastVeh will point to the vehicle component prior to the tail (head, unk_1, unk_2 *here*, tail) or (... bogie, bogie, body *here*, tail)
         VehicleBase* lastVeh = nullptr;
         if (!train.cars.empty())
@@ -391,7 +392,7 @@ namespace OpenLoco::Vehicles
         {
             return false;
         }
-        lastVeh->setNextCar(train.tail->id);
+        lastVeh->setNextCar(tail->id);
         head->sub_4B7CC3();
         return true;
     }
@@ -139,11 +139,24 @@ namespace OpenLoco::Vehicles
         {
             cars = Cars{ Car{ component } };
         }
-        while (component->getSubType() != VehicleThingType::tail)
+        else
         {
-            component = component->nextVehicleComponent();
+            _tail = component->asVehicleTail();
         }
-        tail = component->asVehicleTail();
+    }
+
+    VehicleTail* Vehicle::getTail() const
+    {
+        if (_tail == nullptr)
+        {
+            auto* component = veh2->nextVehicleComponent();
+            while (component->getSubType() != VehicleThingType::tail)
+            {
+                component = component->nextVehicleComponent();
+            }
+            _tail = component->asVehicleTail();
+        }
+        return _tail;
     }
 
     // 0x00426790
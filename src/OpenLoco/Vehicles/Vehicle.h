@@ -247,6 +247,26 @@ namespace OpenLoco::Vehicles
     };
     static_assert(sizeof(VehicleCargo) == 0xA);
 
+    // State shared between the steps of a single VehicleHead::update. The original kept it in
+    // globals, which are still written for the parts of the update not yet implemented.
+    struct UpdateContext
+    {
+        VehicleHead* head;
+        Vehicle1* veh1;
+        Vehicle2* veh2;
+        Status initialStatus;
+        uint32_t manhattanDistanceToStation;
+        int16_t targetZ;
+        uint8_t helicopterTargetYaw;
+        uint32_t airportMovementFlags;
+        // The original movement code moves the bogies and updates var_1136130 as the train moves,
+        // so the bogie and body updates that follow must keep reading the globals for these.
+        VehicleBogie* frontBogie;
+        VehicleBogie* backBogie;
+        int32_t var_113612C; // Speed
+        int32_t var_1136130; // Speed
+    };
+
     struct VehicleHead : VehicleBase
     {
         static constexpr auto vehicleThingType = VehicleThingType::head;
@@ -310,55 +330,55 @@ namespace OpenLoco::Vehicles
 
     private:
         void applyBreakdownToTrain();
-        void updateDrivingSounds();
-        void updateDrivingSound(Vehicle2or6* vehType2or6);
+        void updateDrivingSounds(UpdateContext& ctx);
+        void updateDrivingSound(UpdateContext& ctx, Vehicle2or6* vehType2or6);
         void updateDrivingSoundNone(Vehicle2or6* vehType2or6);
-        void updateDrivingSoundFriction(Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd);
-        void updateDrivingSoundEngine1(Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd);
-        void updateDrivingSoundEngine2(Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd);
+        void updateDrivingSoundFriction(UpdateContext& ctx, Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd);
+        void updateDrivingSoundEngine1(UpdateContext& ctx, Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd);
+        void updateDrivingSoundEngine2(UpdateContext& ctx, Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd);
         void removeDanglingTrain();
-        bool updateLand();
+        bool updateLand(UpdateContext& ctx);
         bool sub_4A8DB7();
         bool sub_4A8F22();
-        bool sub_4A8CB6();
-        bool sub_4A8C81();
+        bool sub_4A8CB6(UpdateContext& ctx);
+        bool sub_4A8C81(UpdateContext& ctx);
         bool landTryBeginUnloading();
         bool landLoadingUpdate();
-        bool landNormalMovementUpdate();
+        bool landNormalMovementUpdate(UpdateContext& ctx);
         bool trainNormalMovementUpdate(uint8_t al, uint8_t flags, StationId_t nextStation);
         bool roadNormalMovementUpdate(uint8_t al, StationId_t nextStation);
         bool landReverseFromSignal();
-        bool updateAir();
-        bool airplaneLoadingUpdate();
-        bool sub_4A95CB();
-        bool sub_4A9348(uint8_t newMovementEdge, uint16_t targetZ);
-        bool airplaneApproachTarget(uint16_t targetZ);
+        bool updateAir(UpdateContext& ctx);
+        bool airplaneLoadingUpdate(UpdateContext& ctx);
+        bool sub_4A95CB(UpdateContext& ctx);
+        bool sub_4A9348(UpdateContext& ctx, uint8_t newMovementEdge, uint16_t targetZ);
+        bool airplaneApproachTarget(UpdateContext& ctx, uint16_t targetZ);
         std::pair<Status, Speed16> airplaneGetNewStatus();
         uint8_t airportGetNextMovementEdge(uint8_t curEdge);
-        std::tuple<uint32_t, uint16_t, uint8_t> sub_427122();
+        std::tuple<uint32_t, uint16_t, uint8_t> sub_427122(UpdateContext& ctx);
         std::pair<uint32_t, Map::Pos3> airportGetMovementEdgeTarget(StationId_t targetStation, uint8_t curEdge);
-        bool updateWater();
+        bool updateWater(UpdateContext& ctx);
         uint32_t getVehicleTotalLength();
-        void tryCreateInitialMovementSound();
+        void tryCreateInitialMovementSound(UpdateContext& ctx);
         void setStationVisitedTypes();
         void checkIfAtOrderStation();
         void updateLastJourneyAverageSpeed();
         void beginUnloading();
         void beginLoading();
         void movePlaneTo(const Map::Pos3& newLoc, const uint8_t newYaw, const Pitch newPitch);
-        uint32_t updateWaterMotion(uint32_t flags);
+        uint32_t updateWaterMotion(UpdateContext& ctx, uint32_t flags);
         void moveBoatTo(const Map::Pos3& loc, const uint8_t yaw, const Pitch pitch);
         uint8_t getLoadingModifier(const VehicleBogie* bogie);
         bool updateUnloadCargoComponent(VehicleCargo& cargo, VehicleBogie* bogie);
-        void updateUnloadCargo();
+        void updateUnloadCargo(UpdateContext& ctx);
         bool updateLoadCargoComponent(VehicleCargo& cargo, VehicleBogie* bogie);
         bool updateLoadCargo();
         void beginNewJourney();
         void advanceToNextRoutableOrder();
         Status sub_427BF2();
-        void produceLeavingDockSound();
+        void produceLeavingDockSound(UpdateContext& ctx);
         std::tuple<StationId_t, Map::Pos2, Map::Pos3> sub_427FC9();
-        void produceTouchdownAirportSound();
+        void produceTouchdownAirportSound(UpdateContext& ctx);
         uint8_t sub_4AA36A();
         void sub_4AD778();
         void sub_4AA625();
@@ -803,7 +823,6 @@ namespace OpenLoco::Vehicles
         VehicleHead* head;
         Vehicle1* veh1;
         Vehicle2* veh2;
-        VehicleTail* tail;
         Cars cars;
 
         Vehicle(const VehicleHead* _head)
@@ -811,5 +830,11 @@ namespace OpenLoco::Vehicles
         {
         }
         Vehicle(uint16_t _head);
+
+        // Finding the tail walks the whole consist, so it is only done when first asked for.
+        VehicleTail* getTail() const;
+
+    private:
+        mutable VehicleTail* _tail = nullptr;
     };
 }
@@ -74,19 +74,29 @@ namespace OpenLoco::Vehicles
     bool VehicleHead::update()
     {
         Vehicle train(this);
-        vehicleUpdate_head = train.head;
-        vehicleUpdate_1 = train.veh1;
-        vehicleUpdate_2 = train.veh2;
-
-        vehicleUpdate_initialStatus = status;
-        updateDrivingSounds();
-
-        vehicleUpdate_frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
-        vehicleUpdate_backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
-
-        Vehicle2* veh2 = vehicleUpdate_2;
-        vehicleUpdate_var_113612C = veh2->currentSpeed.getRaw() >> 7;
-        vehicleUpdate_var_1136130 = veh2->currentSpeed.getRaw() >> 7;
+        UpdateContext ctx{};
+        ctx.head = train.head;
+        ctx.veh1 = train.veh1;
+        ctx.veh2 = train.veh2;
+        ctx.initialStatus = status;
+
+        // Still read by the parts of the update in the original code
+        vehicleUpdate_head = ctx.head;
+        vehicleUpdate_1 = ctx.veh1;
+        vehicleUpdate_2 = ctx.veh2;
+        vehicleUpdate_initialStatus = ctx.initialStatus;
+
+        updateDrivingSounds(ctx);
+
+        ctx.frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        ctx.backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        ctx.var_113612C = ctx.veh2->currentSpeed.getRaw() >> 7;
+        ctx.var_1136130 = ctx.veh2->currentSpeed.getRaw() >> 7;
+
+        vehicleUpdate_frontBogie = ctx.frontBogie;
+        vehicleUpdate_backBogie = ctx.backBogie;
+        vehicleUpdate_var_113612C = ctx.var_113612C;
+        vehicleUpdate_var_1136130 = ctx.var_1136130;
 
         if (var_5C != 0)
         {
@@ -100,8 +110,8 @@ namespace OpenLoco::Vehicles
                 return false;
             }
 
-            train.tail->trainDanglingTimeout++;
-            if (train.tail->trainDanglingTimeout < 960)
+            train.getTail()->trainDanglingTimeout++;
+            if (train.getTail()->trainDanglingTimeout < 960)
             {
                 return false;
             }
@@ -114,18 +124,18 @@ namespace OpenLoco::Vehicles
         {
             case TransportMode::rail:
             case TransportMode::road:
-                continueUpdating = updateLand();
+                continueUpdating = updateLand(ctx);
                 break;
             case TransportMode::air:
-                continueUpdating = updateAir();
+                continueUpdating = updateAir(ctx);
                 break;
             case TransportMode::water:
-                continueUpdating = updateWater();
+                continueUpdating = updateWater(ctx);
                 break;
         }
         if (continueUpdating)
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
         }
         return continueUpdating;
     }
@@ -539,15 +549,15 @@ namespace OpenLoco::Vehicles
         }
     }
     // 0x004A8882
-    void VehicleHead::updateDrivingSounds()
+    void VehicleHead::updateDrivingSounds(UpdateContext& ctx)
     {
         Vehicle train(this);
-        updateDrivingSound(train.veh2->asVehicle2Or6());
-        updateDrivingSound(train.tail->asVehicle2Or6());
+        updateDrivingSound(ctx, train.veh2->asVehicle2Or6());
+        updateDrivingSound(ctx, train.getTail()->asVehicle2Or6());
     }
 
     // 0x004A88A6
-    void VehicleHead::updateDrivingSound(Vehicle2or6* vehType2or6)
+    void VehicleHead::updateDrivingSound(UpdateContext& ctx, Vehicle2or6* vehType2or6)
     {
         if (tile_x == -1 || status == Status::crashed || status == Status::stuck || (var_38 & Flags38::isGhost) || vehType2or6->objectId == 0xFFFF)
         {
@@ -562,13 +572,13 @@ namespace OpenLoco::Vehicles
                 updateDrivingSoundNone(vehType2or6);
                 break;
             case DrivingSoundType::friction:
-                updateDrivingSoundFriction(vehType2or6, &vehicleObject->sound.friction);
+                updateDrivingSoundFriction(ctx, vehType2or6, &vehicleObject->sound.friction);
                 break;
             case DrivingSoundType::engine1:
-                updateDrivingSoundEngine1(vehType2or6, &vehicleObject->sound.engine1);
+                updateDrivingSoundEngine1(ctx, vehType2or6, &vehicleObject->sound.engine1);
                 break;
             case DrivingSoundType::engine2:
-                updateDrivingSoundEngine2(vehType2or6, &vehicleObject->sound.engine2);
+                updateDrivingSoundEngine2(ctx, vehType2or6, &vehicleObject->sound.engine2);
                 break;
             default:
                 break;
@@ -582,9 +592,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A88F7
-    void VehicleHead::updateDrivingSoundFriction(Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd)
+    void VehicleHead::updateDrivingSoundFriction(UpdateContext& ctx, Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd)
     {
-        Vehicle2* vehType2_2 = vehicleUpdate_2;
+        Vehicle2* vehType2_2 = ctx.veh2;
         if (vehType2_2->currentSpeed < snd->minSpeed)
         {
             updateDrivingSoundNone(vehType2or6);
@@ -601,7 +611,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8937
-    void VehicleHead::updateDrivingSoundEngine1(Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd)
+    void VehicleHead::updateDrivingSoundEngine1(UpdateContext& ctx, Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd)
     {
         Vehicle train(this);
         if (vehType2or6->isVehicle2())
@@ -621,7 +631,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        Vehicle2* vehType2_2 = vehicleUpdate_2;
+        Vehicle2* vehType2_2 = ctx.veh2;
         uint16_t targetFrequency = 0;
         uint8_t targetVolume = 0;
         if (vehType2_2->var_5A == 2)
@@ -694,7 +704,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8A39
-    void VehicleHead::updateDrivingSoundEngine2(Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd)
+    void VehicleHead::updateDrivingSoundEngine2(UpdateContext& ctx, Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd)
     {
         Vehicle train(this);
         if (vehType2or6->isVehicle2())
@@ -714,7 +724,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        Vehicle2* vehType2_2 = vehicleUpdate_2;
+        Vehicle2* vehType2_2 = ctx.veh2;
         uint16_t targetFrequency = 0;
         uint8_t targetVolume = 0;
         bool var5aEqual1Code = false;
@@ -832,9 +842,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8C11
-    bool VehicleHead::updateLand()
+    bool VehicleHead::updateLand(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         if ((!(vehType2->var_73 & Flags73::isBrokenDown) || (vehType2->var_73 & Flags73::isStillPowered)) && status == Status::approaching)
         {
             if (mode == TransportMode::road)
@@ -852,13 +862,13 @@ namespace OpenLoco::Vehicles
 
             if (var_0C & Flags0C::commandStop)
             {
-                return sub_4A8CB6();
+                return sub_4A8CB6(ctx);
             }
             else if (var_0C & Flags0C::manualControl)
             {
                 if (var_6E <= -20)
                 {
-                    return sub_4A8C81();
+                    return sub_4A8C81(ctx);
                 }
             }
 
@@ -867,7 +877,7 @@ namespace OpenLoco::Vehicles
 
         if (status == Status::unloading)
         {
-            updateUnloadCargo();
+            updateUnloadCargo(ctx);
 
             return true;
         }
@@ -895,21 +905,21 @@ namespace OpenLoco::Vehicles
                 {
                     if (!(var_0C & Flags0C::commandStop))
                     {
-                        return landNormalMovementUpdate();
+                        return landNormalMovementUpdate(ctx);
                     }
                     else
                     {
-                        return sub_4A8CB6();
+                        return sub_4A8CB6(ctx);
                     }
                 }
                 else
                 {
-                    return sub_4A8C81();
+                    return sub_4A8C81(ctx);
                 }
             }
             else
             {
-                return sub_4A8CB6();
+                return sub_4A8CB6(ctx);
             }
         }
     }
@@ -995,9 +1005,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8CB6
-    bool VehicleHead::sub_4A8CB6()
+    bool VehicleHead::sub_4A8CB6(UpdateContext& ctx)
     {
-        Vehicle1* vehType1 = vehicleUpdate_1;
+        Vehicle1* vehType1 = ctx.veh1;
 
         if (position != vehType1->position)
         {
@@ -1017,7 +1027,7 @@ namespace OpenLoco::Vehicles
         }
 
         status = Status::stopped;
-        vehType2 = vehicleUpdate_2;
+        vehType2 = ctx.veh2;
 
         if (vehType2->var_73 & Flags73::isBrokenDown)
         {
@@ -1028,18 +1038,18 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8C81
-    bool VehicleHead::sub_4A8C81()
+    bool VehicleHead::sub_4A8C81(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         if (vehType2->currentSpeed > 1.0_mph)
         {
-            return landNormalMovementUpdate();
+            return landNormalMovementUpdate(ctx);
         }
 
         auto foundStationId = manualFindTrainStationAtLocation();
         if (foundStationId == StationId::null)
         {
-            return sub_4A8CB6();
+            return sub_4A8CB6(ctx);
         }
         stationId = foundStationId;
         setStationVisitedTypes();
@@ -1047,7 +1057,7 @@ namespace OpenLoco::Vehicles
         updateLastJourneyAverageSpeed();
         beginUnloading();
 
-        return sub_4A8CB6();
+        return sub_4A8CB6(ctx);
     }
 
     // 0x004A8FAC
@@ -1100,10 +1110,10 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8D48
-    bool VehicleHead::landNormalMovementUpdate()
+    bool VehicleHead::landNormalMovementUpdate(UpdateContext& ctx)
     {
         advanceToNextRoutableOrder();
-        auto [al, flags, nextStation] = sub_4ACEE7(0xD4CB00, vehicleUpdate_var_113612C);
+        auto [al, flags, nextStation] = sub_4ACEE7(0xD4CB00, ctx.var_113612C);
 
         if (mode == TransportMode::road)
         {
@@ -1269,17 +1279,19 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A9051
-    bool VehicleHead::updateAir()
+    bool VehicleHead::updateAir(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
 
         if (vehType2->currentSpeed >= 20.0_mph)
         {
-            vehicleUpdate_var_1136130 = 0x4000;
+            ctx.var_1136130 = 0x4000;
+            vehicleUpdate_var_1136130 = ctx.var_1136130;
         }
         else
         {
-            vehicleUpdate_var_1136130 = 0x2000;
+            ctx.var_1136130 = 0x2000;
+            vehicleUpdate_var_1136130 = ctx.var_1136130;
         }
 
         Vehicle train(this);
@@ -1297,18 +1309,18 @@ namespace OpenLoco::Vehicles
         }
         else if (status == Status::unloading)
         {
-            updateUnloadCargo();
+            updateUnloadCargo(ctx);
             return true;
         }
         else if (status == Status::loading)
         {
-            return airplaneLoadingUpdate();
+            return airplaneLoadingUpdate(ctx);
         }
         status = Status::travelling;
         auto [newStatus, targetSpeed] = airplaneGetNewStatus();
 
         status = newStatus;
-        Vehicle1* vehType1 = vehicleUpdate_1;
+        Vehicle1* vehType1 = ctx.veh1;
         vehType1->var_44 = targetSpeed;
 
         advanceToNextRoutableOrder();
@@ -1358,14 +1370,17 @@ namespace OpenLoco::Vehicles
             vehType2->currentSpeed = type2speed;
         }
 
-        auto [manhattanDistance, targetZ, targetYaw] = sub_427122();
+        auto [manhattanDistance, targetZ, targetYaw] = sub_427122(ctx);
 
+        ctx.manhattanDistanceToStation = manhattanDistance;
+        ctx.targetZ = targetZ;
         vehicleUpdate_manhattanDistanceToStation = manhattanDistance;
         vehicleUpdate_targetZ = targetZ;
 
         // Helicopter
-        if (vehicleUpdate_var_525BB0 & AirportMovementNodeFlags::heliTakeoffEnd)
+        if (ctx.airportMovementFlags & AirportMovementNodeFlags::heliTakeoffEnd)
         {
+            ctx.helicopterTargetYaw = targetYaw;
             vehicleUpdate_helicopterTargetYaw = targetYaw;
             targetYaw = sprite_yaw;
             vehType2->var_5A = 1;
@@ -1435,12 +1450,12 @@ namespace OpenLoco::Vehicles
         }
 
         // Helicopter
-        if (vehicleUpdate_var_525BB0 & AirportMovementNodeFlags::heliTakeoffEnd)
+        if (ctx.airportMovementFlags & AirportMovementNodeFlags::heliTakeoffEnd)
         {
             vehType2->currentSpeed = 8.0_mph;
             if (targetZ != position.z)
             {
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
         }
         else
@@ -1457,7 +1472,7 @@ namespace OpenLoco::Vehicles
 
             if (manhattanDistance > targetTolerance)
             {
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
         }
 
@@ -1467,7 +1482,7 @@ namespace OpenLoco::Vehicles
 
             if (flags & AirportMovementNodeFlags::touchdown)
             {
-                produceTouchdownAirportSound();
+                produceTouchdownAirportSound(ctx);
             }
             if (flags & AirportMovementNodeFlags::taxiing)
             {
@@ -1476,7 +1491,7 @@ namespace OpenLoco::Vehicles
 
             if (flags & AirportMovementNodeFlags::terminal)
             {
-                return sub_4A95CB();
+                return sub_4A95CB(ctx);
             }
         }
 
@@ -1490,12 +1505,12 @@ namespace OpenLoco::Vehicles
 
         if (newMovementEdge != static_cast<uint8_t>(-2))
         {
-            return sub_4A9348(newMovementEdge, targetZ);
+            return sub_4A9348(ctx, newMovementEdge, targetZ);
         }
 
         if (vehType2->currentSpeed > 30.0_mph)
         {
-            return airplaneApproachTarget(targetZ);
+            return airplaneApproachTarget(ctx, targetZ);
         }
         else
         {
@@ -1593,12 +1608,12 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A95CB
-    bool VehicleHead::sub_4A95CB()
+    bool VehicleHead::sub_4A95CB(UpdateContext& ctx)
     {
         if (var_0C & Flags0C::commandStop)
         {
             status = Status::stopped;
-            Vehicle2* vehType2 = vehicleUpdate_2;
+            Vehicle2* vehType2 = ctx.veh2;
             vehType2->currentSpeed = 0.0_mph;
         }
         else
@@ -1611,9 +1626,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A95F5
-    bool VehicleHead::airplaneLoadingUpdate()
+    bool VehicleHead::airplaneLoadingUpdate(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         vehType2->currentSpeed = 0.0_mph;
         vehType2->var_5A = 0;
         if (updateLoadCargo())
@@ -1637,7 +1652,7 @@ namespace OpenLoco::Vehicles
         {
             // Strangely the original would enter this function with an
             // uninitialised targetZ. We will pass a valid z.
-            return sub_4A9348(newMovementEdge, position.z);
+            return sub_4A9348(ctx, newMovementEdge, position.z);
         }
 
         status = Status::loading;
@@ -1645,17 +1660,17 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A94A9
-    bool VehicleHead::airplaneApproachTarget(uint16_t targetZ)
+    bool VehicleHead::airplaneApproachTarget(UpdateContext& ctx, uint16_t targetZ)
     {
         auto _yaw = sprite_yaw;
         // Helicopter
-        if (vehicleUpdate_var_525BB0 & AirportMovementNodeFlags::heliTakeoffEnd)
+        if (ctx.airportMovementFlags & AirportMovementNodeFlags::heliTakeoffEnd)
         {
-            _yaw = vehicleUpdate_helicopterTargetYaw;
+            _yaw = ctx.helicopterTargetYaw;
         }
 
-        Vehicle1* vehType1 = vehicleUpdate_1;
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle1* vehType1 = ctx.veh1;
+        Vehicle2* vehType2 = ctx.veh2;
 
         auto [veh1Loc, veh2Loc] = calculateNextPosition(
             _yaw, position, vehType1, vehType2->currentSpeed);
@@ -1666,7 +1681,7 @@ namespace OpenLoco::Vehicles
         if (targetZ != position.z)
         {
             // Final section of landing / helicopter
-            if (vehicleUpdate_manhattanDistanceToStation <= 28)
+            if (ctx.manhattanDistanceToStation <= 28)
             {
                 int16_t z_shift = 1;
                 if (vehType2->currentSpeed >= 50.0_mph)
@@ -1692,7 +1707,7 @@ namespace OpenLoco::Vehicles
                 int32_t zDiff = targetZ - position.z;
                 // We want a SAR instruction so use >>5
                 int32_t param1 = (zDiff * toSpeed16(vehType2->currentSpeed).getRaw()) >> 5;
-                int32_t param2 = vehicleUpdate_manhattanDistanceToStation - 18;
+                int32_t param2 = ctx.manhattanDistanceToStation - 18;
 
                 auto modulo = param1 % param2;
                 if (modulo < 0)
@@ -1709,7 +1724,7 @@ namespace OpenLoco::Vehicles
         return true;
     }
 
-    bool VehicleHead::sub_4A9348(uint8_t newMovementEdge, uint16_t targetZ)
+    bool VehicleHead::sub_4A9348(UpdateContext& ctx, uint8_t newMovementEdge, uint16_t targetZ)
     {
         if (stationId != StationId::null && airportMovementEdge != cAirportMovementNodeNull)
         {
@@ -1724,7 +1739,7 @@ namespace OpenLoco::Vehicles
             {
                 // 0x4a94a5
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             auto orders = getCurrentOrders();
@@ -1732,7 +1747,7 @@ namespace OpenLoco::Vehicles
             if (order == nullptr)
             {
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             StationId_t orderStationId = order->getStation();
@@ -1742,14 +1757,14 @@ namespace OpenLoco::Vehicles
             if (station == nullptr || !(station->flags & StationFlags::flag_6))
             {
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             if (!isPlayerCompany(owner))
             {
                 stationId = orderStationId;
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             Pos3 loc = {
@@ -1776,7 +1791,7 @@ namespace OpenLoco::Vehicles
                 {
                     stationId = orderStationId;
                     airportMovementEdge = cAirportMovementNodeNull;
-                    return airplaneApproachTarget(targetZ);
+                    return airplaneApproachTarget(ctx, targetZ);
                 }
 
                 if (owner == CompanyManager::getControllingId())
@@ -1789,7 +1804,7 @@ namespace OpenLoco::Vehicles
                 }
 
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             // Todo: fail gracefully on tile not found
@@ -1806,7 +1821,7 @@ namespace OpenLoco::Vehicles
                 auto station = StationManager::get(stationId);
                 station->airportMovementOccupiedEdges |= (1 << airportMovementEdge);
             }
-            return airplaneApproachTarget(targetZ);
+            return airplaneApproachTarget(ctx, targetZ);
         }
     }
 
@@ -1819,16 +1834,18 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A9649
-    bool VehicleHead::updateWater()
+    bool VehicleHead::updateWater(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         if (vehType2->currentSpeed >= 5.0_mph)
         {
-            vehicleUpdate_var_1136130 = 0x4000;
+            ctx.var_1136130 = 0x4000;
+            vehicleUpdate_var_1136130 = ctx.var_1136130;
         }
         else
         {
-            vehicleUpdate_var_1136130 = 0x2000;
+            ctx.var_1136130 = 0x2000;
+            vehicleUpdate_var_1136130 = ctx.var_1136130;
         }
 
         Vehicle train(this);
@@ -1854,7 +1871,7 @@ namespace OpenLoco::Vehicles
 
         if (var_0C & Flags0C::commandStop)
         {
-            if (!(updateWaterMotion(WaterMotionFlags::isStopping) & WaterMotionFlags::hasReachedADestination))
+            if (!(updateWaterMotion(ctx, WaterMotionFlags::isStopping) & WaterMotionFlags::hasReachedADestination))
             {
                 return true;
             }
@@ -1867,7 +1884,7 @@ namespace OpenLoco::Vehicles
 
         if (status == Status::unloading)
         {
-            updateUnloadCargo();
+            updateUnloadCargo(ctx);
             return true;
         }
         else if (status == Status::loading)
@@ -1881,8 +1898,8 @@ namespace OpenLoco::Vehicles
             advanceToNextRoutableOrder();
             status = Status::travelling;
             status = sub_427BF2();
-            updateWaterMotion(WaterMotionFlags::isLeavingDock);
-            produceLeavingDockSound();
+            updateWaterMotion(ctx, WaterMotionFlags::isLeavingDock);
+            produceLeavingDockSound(ctx);
             return true;
         }
         else
@@ -1890,7 +1907,7 @@ namespace OpenLoco::Vehicles
             status = Status::travelling;
             status = sub_427BF2();
             advanceToNextRoutableOrder();
-            if (!(updateWaterMotion(0) & WaterMotionFlags::hasReachedDock))
+            if (!(updateWaterMotion(ctx, 0) & WaterMotionFlags::hasReachedDock))
             {
                 return true;
             }
@@ -1917,10 +1934,11 @@ namespace OpenLoco::Vehicles
      *  manhattanDistance = regs.ebp
      *  targetZ = regs.dx
      *  targetYaw = regs.bl
-     *  airportFlags = vehicleUpdate_var_525BB0
+     *  airportFlags = ctx.airportMovementFlags
      */
-    std::tuple<uint32_t, uint16_t, uint8_t> VehicleHead::sub_427122()
+    std::tuple<uint32_t, uint16_t, uint8_t> VehicleHead::sub_427122(UpdateContext& ctx)
     {
+        ctx.airportMovementFlags = 0;
         vehicleUpdate_var_525BB0 = 0;
         StationId_t targetStationId = StationId::null;
         std::optional<Map::Pos3> targetPos{};
@@ -1954,6 +1972,7 @@ namespace OpenLoco::Vehicles
                 else
                 {
                     auto [flags, pos] = airportGetMovementEdgeTarget(stationId, airportMovementEdge);
+                    ctx.airportMovementFlags = flags;
                     vehicleUpdate_var_525BB0 = flags;
                     targetPos = pos;
                 }
@@ -2189,14 +2208,14 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004B980A
-    void VehicleHead::tryCreateInitialMovementSound()
+    void VehicleHead::tryCreateInitialMovementSound(UpdateContext& ctx)
     {
         if (status != Status::travelling)
         {
             return;
         }
 
-        if (vehicleUpdate_initialStatus != Status::stopped && vehicleUpdate_initialStatus != Status::waitingAtSignal)
+        if (ctx.initialStatus != Status::stopped && ctx.initialStatus != Status::waitingAtSignal)
         {
             return;
         }
@@ -2213,7 +2232,7 @@ namespace OpenLoco::Vehicles
             }
             auto randSoundIndex = gPrng().randNext(numSounds - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             auto tileHeight = TileManager::getHeight(veh2->position);
             auto volume = 0;
             if (veh2->position.z < tileHeight.landHeight)
@@ -2319,9 +2338,9 @@ namespace OpenLoco::Vehicles
     // Output flags:
     // bit 16 : reachedDock
     // bit 17 : reachedADestination
-    uint32_t VehicleHead::updateWaterMotion(uint32_t flags)
+    uint32_t VehicleHead::updateWaterMotion(UpdateContext& ctx, uint32_t flags)
     {
-        Vehicle2* veh2 = vehicleUpdate_2;
+        Vehicle2* veh2 = ctx.veh2;
 
         // updates the current boats position and sets flags about position
         auto tile = TileManager::get(veh2->position);
@@ -2487,7 +2506,7 @@ namespace OpenLoco::Vehicles
             veh2->sprite_yaw &= 0x3F;
         }
 
-        Vehicle1* veh1 = vehicleUpdate_1;
+        Vehicle1* veh1 = ctx.veh1;
         auto [newVeh1Pos, newVeh2Pos] = calculateNextPosition(veh2->sprite_yaw, veh2->position, veh1, veh2->currentSpeed);
 
         veh1->var_4E = newVeh1Pos.x;
@@ -2724,7 +2743,7 @@ namespace OpenLoco::Vehicles
         }
     }
     // 0x004B9A2A
-    void VehicleHead::updateUnloadCargo()
+    void VehicleHead::updateUnloadCargo(UpdateContext& ctx)
     {
         if (cargoTransferTimeout != 0)
         {
@@ -2777,9 +2796,9 @@ namespace OpenLoco::Vehicles
                 auto company = CompanyManager::get(owner);
                 company->var_4A8[var_60].var_80 += cargoProfit;
             }
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             veh2->lifetimeProfit += cargoProfit;
-            Vehicle1* veh1 = vehicleUpdate_1;
+            Vehicle1* veh1 = ctx.veh1;
             if (cargoProfit != 0)
             {
                 veh1->var_48 |= (1 << 2);
@@ -3102,7 +3121,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x0042843E
-    void VehicleHead::produceLeavingDockSound()
+    void VehicleHead::produceLeavingDockSound(UpdateContext& ctx)
     {
         Vehicle train(this);
         auto* vehObj = train.cars.firstCar.body->object();
@@ -3110,7 +3129,7 @@ namespace OpenLoco::Vehicles
         {
             auto randSoundIndex = gPrng().randNext((vehObj->numStartSounds & NumStartSounds::mask) - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             Audio::playSound(randSoundId, veh2->position + Map::Pos3{ 0, 0, 22 }, 0, 22050);
         }
     }
@@ -3127,7 +3146,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x0042750E
-    void VehicleHead::produceTouchdownAirportSound()
+    void VehicleHead::produceTouchdownAirportSound(UpdateContext& ctx)
     {
         Vehicle train(this);
         auto* vehObj = train.cars.firstCar.body->object();
@@ -3137,7 +3156,7 @@ namespace OpenLoco::Vehicles
             auto randSoundIndex = gPrng().randNext((vehObj->numStartSounds & NumStartSounds::mask) - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
 
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             Audio::playSound(randSoundId, veh2->position + Map::Pos3{ 0, 0, 22 }, 0, 22050);
         }
     }
@@ -517,7 +517,7 @@ namespace OpenLoco::Ui::Windows::Terraform
         static loco_global<uint8_t, 0x00525FB4> _currentSnowLine;
 
         // 0x004BDF19
-        static std::optional<uint8_t> getRandomTreeTypeFromSurface(const Map::TilePos2& loc, bool unk)
+        static std::optional<uint8_t> getRandomTreeTypeFromSurface(const Map::TilePos2& loc, bool unk, const Map::TileCountTable* waterTiles = nullptr)
         {
             if (!Map::validCoords(loc))
             {
@@ -563,7 +563,7 @@ namespace OpenLoco::Ui::Windows::Terraform
                 return {};
             }
             mustNotTreeFlags |= TreeObjectFlags::requiresWater;
-            const uint16_t numSameTypeSurfaces = TileManager::countSurroundingWaterTiles(loc);
+            const uint16_t numSameTypeSurfaces = waterTiles != nullptr ? TileManager::countSurroundingWaterTiles(*waterTiles, loc) : TileManager::countSurroundingWaterTiles(loc);
             if (numSameTypeSurfaces >= 8)
             {
                 mustNotTreeFlags &= ~TreeObjectFlags::requiresWater;
@@ -604,6 +604,8 @@ namespace OpenLoco::Ui::Windows::Terraform
         {
             const auto numPlacements = (range * range * density) / 8192;
             uint16_t numErrors = 0;
+            std::vector<GameCommands::TreePlacementArgs> placements;
+            placements.reserve(numPlacements);
             for (auto i = 0; i < numPlacements; ++i)
             {
                 // Choose a random offset in a circle
@@ -629,19 +631,13 @@ namespace OpenLoco::Ui::Windows::Terraform
                 args.type = *type;
                 args.buildImmediately = true;
                 args.requiresFullClearance = true;
-
-                // First query if we can place a tree at this location; skip if we can't.
-                auto queryRes = doCommand(args, 0);
-                if (queryRes == GameCommands::FAILURE)
-                {
-                    numErrors++;
-                    continue;
-                }
-
-                // Actually place the tree
-                doCommand(args, GameCommands::Flags::apply);
+                placements.push_back(args);
             }
 
+            // Query and place all trees as one command so the cost is only charged once.
+            auto res = GameCommands::doCommandBatch(placements, GameCommands::Flags::apply);
+            numErrors += res.numFailed;
+
             // Have we placed any trees?
             if (numErrors < numPlacements)
                 return true;
@@ -691,7 +687,16 @@ namespace OpenLoco::Ui::Windows::Terraform
                         if (isEditorMode())
                             CompanyManager::updatingCompanyId(CompanyId::neutral);
 
-                        if (clusterToolDown(*placementArgs, 384, 4, getRandomTreeTypeFromSurface))
+                        // Count water once for the whole cluster rather than an 11x11 area per tree
+                        constexpr coord_t clusterRange = 384;
+                        const auto margin = Map::TilePos2(clusterRange / Map::tile_size + 1 + 5, clusterRange / Map::tile_size + 1 + 5);
+                        const auto centre = Map::TilePos2(placementArgs->pos);
+                        const auto waterTiles = TileManager::buildWaterTileTable(centre - margin, centre + margin);
+                        auto getTreeType = [&waterTiles](const Map::TilePos2& loc, bool unk) {
+                            return getRandomTreeTypeFromSurface(loc, unk, &waterTiles);
+                        };
+
+                        if (clusterToolDown(*placementArgs, clusterRange, 4, getTreeType))
                         {
                             auto height = TileManager::getHeight(placementArgs->pos);
                             Audio::playSound(Audio::SoundId::construct, Map::Pos3{ placementArgs->pos.x, placementArgs->pos.y, height.landHeight });
@@ -119,6 +119,8 @@ namespace OpenLoco::Ui::Windows::TimePanel
         _widgets[Widx::normal_speed_btn].image = Gfx::recolour(ImageIds::speed_normal);
         _widgets[Widx::fast_forward_btn].image = Gfx::recolour(ImageIds::speed_fast_forward);
         _widgets[Widx::extra_fast_forward_btn].image = Gfx::recolour(ImageIds::speed_extra_fast_forward);
+        _widgets[Widx::extra_fast_forward_btn].tooltip = StringIds::tooltip_speed_extra_fast_forward;
+        window->activated_widgets &= ~(1ULL << Widx::extra_fast_forward_btn);
 
         if (isPaused())
         {
@@ -132,9 +134,16 @@ namespace OpenLoco::Ui::Windows::TimePanel
         {
             _widgets[Widx::fast_forward_btn].image = Gfx::recolour(ImageIds::speed_fast_forward_active);
         }
-        else if (getGameSpeed() == 2)
+        else if (getGameSpeed() >= GameSpeed::extraFastForward)
         {
             _widgets[Widx::extra_fast_forward_btn].image = Gfx::recolour(ImageIds::speed_extra_fast_forward_active);
+
+            // Uncapped shares the extra fast forward button, so it is drawn pressed in instead
+            if (getGameSpeed() == GameSpeed::uncapped)
+            {
+                _widgets[Widx::extra_fast_forward_btn].tooltip = StringIds::tooltip_speed_uncapped;
+                window->activated_widgets |= (1ULL << Widx::extra_fast_forward_btn);
+            }
         }
 
         if (isNetworked())
@@ -222,7 +231,8 @@ namespace OpenLoco::Ui::Windows::TimePanel
                 changeGameSpeed(window, 1);
                 break;
             case Widx::extra_fast_forward_btn:
-                changeGameSpeed(window, 2);
+                // Clicking again while already at extra speed lifts the speed limit altogether
+                changeGameSpeed(window, getGameSpeed() == GameSpeed::extraFastForward ? GameSpeed::uncapped : GameSpeed::extraFastForward);
                 break;
         }
     }
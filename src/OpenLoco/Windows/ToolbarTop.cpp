@@ -21,6 +21,7 @@
 #include "../StationManager.h"
 #include "../TownManager.h"
 #include "../Ui/Dropdown.h"
+#include "../Ui/Screenshot.h"
 #include "../Ui/WindowManager.h"
 #include "../Vehicles/Vehicle.h"
 #include "../Widget.h"
@@ -125,10 +126,11 @@ namespace OpenLoco::Ui::Windows::ToolbarTop::Game
         Dropdown::add(3, StringIds::menu_about);
         Dropdown::add(4, StringIds::options);
         Dropdown::add(5, StringIds::menu_screenshot);
-        Dropdown::add(6, 0);
-        Dropdown::add(7, StringIds::menu_quit_to_menu);
-        Dropdown::add(8, StringIds::menu_exit_openloco);
-        Dropdown::showBelow(window, widgetIndex, 9, 0);
+        Dropdown::add(6, StringIds::menu_giant_screenshot);
+        Dropdown::add(7, 0);
+        Dropdown::add(8, StringIds::menu_quit_to_menu);
+        Dropdown::add(9, StringIds::menu_exit_openloco);
+        Dropdown::showBelow(window, widgetIndex, 10, 0);
         Dropdown::setHighlightedItem(1);
     }
 
@@ -202,12 +204,23 @@ namespace OpenLoco::Ui::Windows::ToolbarTop::Game
                 break;
             }
 
-            case 7:
+            case 6:
+                try
+                {
+                    Input::startGiantScreenshot();
+                }
+                catch (const std::exception&)
+                {
+                    Windows::showError(StringIds::screenshot_failed);
+                }
+                break;
+
+            case 8:
                 // Return to title screen
                 GameCommands::do_21(0, 1);
                 break;
 
-            case 8:
+            case 9:
                 // Exit to desktop
                 GameCommands::do_21(0, 2);
                 break;
@@ -1481,7 +1481,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
                 pos.y += self.row_height;
             }
 
-            if (self.row_hover == train.tail->id && _dragCarComponent != nullptr)
+            if (self.row_hover == train.getTail()->id && _dragCarComponent != nullptr)
             {
                 Gfx::fillRect(context, 0, pos.y - 1, self.width, pos.y, 0x2000030);
             }
@@ -1539,7 +1539,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
             {
                 auto head = Common::getVehicle(&self);
                 Vehicles::Vehicle train(head);
-                return train.tail;
+                return train.getTail();
             }
             return car->front;
         }